@@ -0,0 +1,153 @@
+#include "art_cache.h"
+#include "fnv1a.h"
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace PlexTUI {
+
+namespace {
+
+constexpr const char* ENTRY_SUFFIX = ".img";
+
+} // namespace
+
+ArtCache::ArtCache(std::string directory, size_t budget_bytes)
+    : dir(std::move(directory)), budget(budget_bytes) {
+}
+
+std::string ArtCache::default_directory() {
+    const char* xdg = getenv("XDG_CACHE_HOME");
+    if (xdg && *xdg) {
+        return std::string(xdg) + "/plex-tui/art";
+    }
+    const char* home = getenv("HOME");
+    if (home) {
+        return std::string(home) + "/.cache/plex-tui/art";
+    }
+    return "";
+}
+
+std::string ArtCache::path_for(const std::string& key) const {
+    char name[24];
+    snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(fnv1a_64(key)));
+    return dir + "/" + name + ENTRY_SUFFIX;
+}
+
+bool ArtCache::load(const std::string& key, std::vector<uint8_t>& data) {
+    if (dir.empty()) return false;
+    std::string path = path_for(key);
+
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) return false;
+    std::streamsize size = in.tellg();
+    if (size <= 0) return false;
+    data.resize(static_cast<size_t>(size));
+    in.seekg(0);
+    if (!in.read(reinterpret_cast<char*>(data.data()), size)) {
+        data.clear();
+        return false;
+    }
+
+    // mtime is the LRU clock
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+void ArtCache::store(const std::string& key, const std::vector<uint8_t>& data) {
+    if (dir.empty() || data.empty() || data.size() > budget) return;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    if (ec) return;
+    scan();
+
+    // Write beside the final name and rename over it: readers (including other
+    // instances) never see a partial file
+    std::string path = path_for(key);
+    std::string temp = path + ".tmp" + std::to_string(getpid());
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out) return;
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!out) {
+            out.close();
+            fs::remove(temp, ec);
+            return;
+        }
+    }
+
+    uintmax_t replaced = fs::file_size(path, ec);
+    if (ec) replaced = 0;
+    fs::rename(temp, path, ec);
+    if (ec) {
+        fs::remove(temp, ec);
+        return;
+    }
+    total_bytes = total_bytes - std::min<size_t>(total_bytes, static_cast<size_t>(replaced)) + data.size();
+
+    if (total_bytes > budget) {
+        evict();
+    }
+}
+
+void ArtCache::remove(const std::string& key) {
+    if (dir.empty()) return;
+    std::lock_guard<std::mutex> lock(mutex);
+    std::string path = path_for(key);
+    std::error_code ec;
+    uintmax_t size = fs::file_size(path, ec);
+    if (!ec && fs::remove(path, ec)) {
+        total_bytes -= std::min<size_t>(total_bytes, static_cast<size_t>(size));
+    }
+}
+
+void ArtCache::scan() {
+    if (scanned) return;
+    scanned = true;
+    total_bytes = 0;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(dir, ec)) {
+        if (entry.path().extension() == ENTRY_SUFFIX && entry.is_regular_file(ec)) {
+            total_bytes += static_cast<size_t>(entry.file_size(ec));
+        }
+    }
+}
+
+void ArtCache::evict() {
+    struct Entry {
+        fs::path path;
+        fs::file_time_type mtime;
+        size_t size;
+    };
+    std::vector<Entry> entries;
+    std::error_code ec;
+    size_t on_disk = 0;
+    for (const auto& entry : fs::directory_iterator(dir, ec)) {
+        if (entry.path().extension() != ENTRY_SUFFIX || !entry.is_regular_file(ec)) continue;
+        Entry e{entry.path(), entry.last_write_time(ec), static_cast<size_t>(entry.file_size(ec))};
+        on_disk += e.size;
+        entries.push_back(std::move(e));
+    }
+    total_bytes = on_disk;  // Resync with what other instances may have added
+
+    // Least recently used first; evict down to 90% so stores don't evict every time
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return a.mtime < b.mtime; });
+    size_t target = budget / 10 * 9;
+    for (const auto& e : entries) {
+        if (total_bytes <= target) break;
+        if (fs::remove(e.path, ec)) {
+            total_bytes -= std::min(total_bytes, e.size);
+        }
+    }
+}
+
+} // namespace PlexTUI
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <mutex>
+
+namespace PlexTUI {
+
+/**
+ * Persistent album art cache
+ * Compressed images on disk (~/.cache/plex-tui/art), one file per request URL.
+ * Plex thumb URLs carry the item's update timestamp and the transcode size, so
+ * a URL never changes meaning and entries never need revalidating. Reads touch
+ * the file's mtime; once the directory exceeds its byte budget the least
+ * recently used files are deleted.
+ */
+class ArtCache {
+public:
+    ArtCache(std::string directory, size_t budget_bytes);
+
+    // Cached bytes for key (a hit refreshes its LRU position)
+    bool load(const std::string& key, std::vector<uint8_t>& data);
+
+    // Atomically write an entry (temp file + rename), then enforce the budget
+    void store(const std::string& key, const std::vector<uint8_t>& data);
+
+    // Drop an entry that turned out to be unusable
+    void remove(const std::string& key);
+
+    // $XDG_CACHE_HOME/plex-tui/art, else ~/.cache/plex-tui/art
+    static std::string default_directory();
+
+private:
+    std::string path_for(const std::string& key) const;
+    void scan();   // Size the existing entries (first use)
+    void evict();  // Delete oldest entries until under budget
+
+    std::string dir;
+    size_t budget;
+    size_t total_bytes = 0;
+    bool scanned = false;
+    std::mutex mutex;
+};
+
+} // namespace PlexTUI
@@ -0,0 +1,123 @@
+#include "art_loader.h"
+
+namespace PlexTUI {
+
+ArtLoader::ArtLoader() {
+    running = true;
+    worker = std::thread(&ArtLoader::worker_func, this);
+}
+
+ArtLoader::~ArtLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+        queue.clear();
+    }
+    cv.notify_all();
+    if (worker.joinable()) {
+        worker.join();  // At most the one download in progress
+    }
+}
+
+std::string ArtLoader::key_for(const std::string& art_url, int cells_w, int cells_h) {
+    return art_url + '#' + std::to_string(cells_w) + 'x' + std::to_string(cells_h);
+}
+
+void ArtLoader::request(const std::string& server, const std::string& access_token,
+                        const std::vector<Request>& wanted) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        server_url = server;
+        token = access_token;
+
+        // Rebuild the queue from scratch: requests for items scrolled away from
+        // are cancelled simply by not being carried over
+        queue.clear();
+        for (const auto& req : wanted) {
+            if (req.art_url.empty() || req.cells_w <= 0 || req.cells_h <= 0) continue;
+            std::string key = key_for(req.art_url, req.cells_w, req.cells_h);
+            if (key == in_flight || !wanted_again(key)) continue;
+            queue.push_back(req);
+        }
+        if (queue.empty()) return;
+    }
+    cv.notify_one();
+}
+
+std::shared_ptr<AlbumArt> ArtLoader::get(const std::string& art_url, int cells_w, int cells_h) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = loaded.find(key_for(art_url, cells_w, cells_h));
+    if (it == loaded.end()) return nullptr;
+    lru.splice(lru.begin(), lru, it->second.second);
+    return it->second.first;
+}
+
+bool ArtLoader::wanted_again(const std::string& key) const {
+    // Caller holds the mutex. Not loaded yet, or a failure whose backoff is over
+    if (!loaded.count(key)) return true;
+    auto failed = retry_at.find(key);
+    return failed != retry_at.end() && std::chrono::steady_clock::now() >= failed->second;
+}
+
+void ArtLoader::store(const std::string& key, std::shared_ptr<AlbumArt> art) {
+    // Caller holds the mutex
+    if (art->has_art()) {
+        retry_at.erase(key);
+    } else {
+        retry_at[key] = std::chrono::steady_clock::now() + RETRY_AFTER;
+    }
+    auto existing = loaded.find(key);
+    if (existing != loaded.end()) {
+        lru.erase(existing->second.second);  // A retry replaces the failed entry
+    }
+    lru.push_front(key);
+    loaded[key] = {std::move(art), lru.begin()};
+    while (loaded.size() > MAX_LOADED) {
+        loaded.erase(lru.back());
+        retry_at.erase(lru.back());
+        lru.pop_back();
+    }
+}
+
+void ArtLoader::worker_func() {
+    while (true) {
+        Request req;
+        std::string key;
+        std::string server;
+        std::string access_token;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [this] { return !queue.empty() || !running; });
+            if (!running) break;
+            req = std::move(queue.front());
+            queue.pop_front();
+            key = key_for(req.art_url, req.cells_w, req.cells_h);
+            if (!wanted_again(key)) continue;
+            in_flight = key;
+            server = server_url;
+            access_token = token;
+        }
+
+        // Fetch, decode and render off the UI thread; the UI only ever sees the
+        // finished object, so AlbumArt itself needs no locking
+        auto art = std::make_shared<AlbumArt>();
+        art->set_display_size(req.cells_w, req.cells_h);
+        try {
+            if (art->fetch_art(server, access_token, req.art_url)) {
+                if (AlbumArt::graphics() == GraphicsProtocol::None) {
+                    art->render_pixelated(req.cells_w, req.cells_h, Theme());
+                } else {
+                    art->prepare_graphics(req.cells_w, req.cells_h);  // Encode kitty/sixel payload here
+                }
+            }
+        } catch (...) {
+            art->clear();  // Published without art: shown as missing until the retry
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        in_flight.clear();
+        store(key, std::move(art));
+    }
+}
+
+} // namespace PlexTUI
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "audio_decoder.h"
+#include <string>
+#include <vector>
+#include <deque>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace PlexTUI {
+
+/**
+ * Background album art loader
+ * Fetches, decodes and pre-renders art on a worker thread so drawing never
+ * waits on the network. Views state what they want in priority order every
+ * frame (the selection first, then its neighbours); anything queued that is
+ * no longer wanted is dropped before it is fetched. Finished art stays in a
+ * small LRU so moving back to a neighbour is instant.
+ */
+class ArtLoader {
+public:
+    struct Request {
+        std::string art_url;
+        int cells_w = 0;
+        int cells_h = 0;
+    };
+
+    ArtLoader();
+    ~ArtLoader();
+
+    // Replace the wanted set (highest priority first)
+    void request(const std::string& server, const std::string& token, const std::vector<Request>& wanted);
+
+    // Finished art, rendered at cells_w x cells_h (nullptr while still loading).
+    // A failed load returns art without has_art(); it is fetched again once
+    // RETRY_AFTER has passed and the view still wants it.
+    std::shared_ptr<AlbumArt> get(const std::string& art_url, int cells_w, int cells_h);
+
+private:
+    static std::string key_for(const std::string& art_url, int cells_w, int cells_h);
+    void worker_func();
+    void store(const std::string& key, std::shared_ptr<AlbumArt> art);
+    bool wanted_again(const std::string& key) const;
+
+    static constexpr size_t MAX_LOADED = 32;  // Finished images kept (LRU)
+    static constexpr std::chrono::seconds RETRY_AFTER{15};
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool running = false;
+    std::string server_url;
+    std::string token;
+    std::deque<Request> queue;    // Pending, highest priority first
+    std::string in_flight;        // Key being fetched right now
+    std::unordered_map<std::string, std::pair<std::shared_ptr<AlbumArt>, std::list<std::string>::iterator>> loaded;
+    std::list<std::string> lru;   // Most recently used first
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> retry_at;  // Failed loads in `loaded`
+};
+
+} // namespace PlexTUI
@@ -1,10 +1,16 @@
 #include "audio_decoder.h"
+#include "terminal.h"
+#include "art_cache.h"
+#include "http_pool.h"
+#include "url_encode.h"
 #include <cstring>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <algorithm>
 #include <cmath>
+#include <array>
+#include <climits>
 #include <cstring>
 #include <thread>
 #include <chrono>
@@ -12,6 +18,10 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <unistd.h>
+#include <csetjmp>
+#include <cstdio>
+#include <jpeglib.h>
+#include <png.h>
 
 #ifdef __APPLE__
 #include <unistd.h>
@@ -692,89 +702,647 @@ float AudioDecoder::get_current_level() const {
     return current_level;
 }
 
+namespace {
+
+// libjpeg reports fatal errors through error_exit; jump back instead of exit()
+struct JpegErrorManager {
+    jpeg_error_mgr base;
+    jmp_buf escape;
+};
+
+void jpeg_error_exit(j_common_ptr cinfo) {
+    longjmp(reinterpret_cast<JpegErrorManager*>(cinfo->err)->escape, 1);
+}
+
+// Warnings (corrupt data, extraneous bytes) would print over the TUI: drop them
+void jpeg_silent_message(j_common_ptr) {
+}
+
+// Larger covers are refused before their pixel buffer is allocated
+constexpr unsigned MAX_ART_SIDE = 8192;
+
+// Only trivially destructible locals between setjmp and the libjpeg calls
+bool decode_jpeg(const std::vector<uint8_t>& data, std::vector<uint8_t>& rgb, int& width, int& height,
+                 unsigned min_side) {
+    jpeg_decompress_struct cinfo;
+    JpegErrorManager err;
+    cinfo.err = jpeg_std_error(&err.base);
+    err.base.error_exit = jpeg_error_exit;
+    err.base.output_message = jpeg_silent_message;
+    if (setjmp(err.escape)) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+    
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, data.data(), static_cast<unsigned long>(data.size()));
+    jpeg_read_header(&cinfo, TRUE);
+    if (cinfo.image_width > MAX_ART_SIDE || cinfo.image_height > MAX_ART_SIDE) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+    cinfo.out_color_space = JCS_RGB;
+    // Terminal art never needs more than min_side pixels: let the IDCT downscale
+    // large covers (1/2, 1/4, 1/8) instead of decoding every pixel
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = 1;
+    while (cinfo.scale_denom < 8 &&
+           std::min(cinfo.image_width, cinfo.image_height) / (cinfo.scale_denom * 2) >= min_side) {
+        cinfo.scale_denom *= 2;
+    }
+    jpeg_start_decompress(&cinfo);
+    
+    width = static_cast<int>(cinfo.output_width);
+    height = static_cast<int>(cinfo.output_height);
+    rgb.resize(static_cast<size_t>(width) * height * 3);
+    while (cinfo.output_scanline < cinfo.output_height) {
+        JSAMPROW row = rgb.data() + static_cast<size_t>(cinfo.output_scanline) * width * 3;
+        jpeg_read_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    return width > 0 && height > 0;
+}
+
+bool decode_png(const std::vector<uint8_t>& data, std::vector<uint8_t>& rgb, int& width, int& height) {
+    png_image image;
+    std::memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_memory(&image, data.data(), data.size())) {
+        return false;
+    }
+    if (image.width > MAX_ART_SIDE || image.height > MAX_ART_SIDE) {
+        png_image_free(&image);
+        return false;
+    }
+    image.format = PNG_FORMAT_RGB;
+    rgb.resize(PNG_IMAGE_SIZE(image));
+    png_color black{0, 0, 0};  // Transparent areas composite onto the black background
+    if (!png_image_finish_read(&image, &black, rgb.data(), 0, nullptr)) {
+        png_image_free(&image);
+        return false;
+    }
+    width = static_cast<int>(image.width);
+    height = static_cast<int>(image.height);
+    return width > 0 && height > 0;
+}
+
+// Area-averaging (box filter) resize of packed RGB24. Each output row sums its
+// band of source rows into a column accumulator (a flat loop the compiler
+// vectorizes), then averages horizontal spans of it. Enlarging falls back to
+// nearest-neighbour, which suits the pixelated look.
+void box_downscale(const uint8_t* src, int src_w, int src_h, uint8_t* dst, int dst_w, int dst_h) {
+    const size_t src_stride = static_cast<size_t>(src_w) * 3;
+    std::vector<uint32_t> column_sums(src_stride);
+    
+    for (int oy = 0; oy < dst_h; ++oy) {
+        int y0 = static_cast<int>(static_cast<int64_t>(oy) * src_h / dst_h);
+        int y1 = std::max(y0 + 1, static_cast<int>(static_cast<int64_t>(oy + 1) * src_h / dst_h));
+        
+        std::fill(column_sums.begin(), column_sums.end(), 0u);
+        for (int sy = y0; sy < y1; ++sy) {
+            const uint8_t* row = src + static_cast<size_t>(sy) * src_stride;
+            uint32_t* sums = column_sums.data();
+            for (size_t i = 0; i < src_stride; ++i) {
+                sums[i] += row[i];
+            }
+        }
+        
+        uint8_t* out = dst + static_cast<size_t>(oy) * dst_w * 3;
+        for (int ox = 0; ox < dst_w; ++ox) {
+            int x0 = static_cast<int>(static_cast<int64_t>(ox) * src_w / dst_w);
+            int x1 = std::max(x0 + 1, static_cast<int>(static_cast<int64_t>(ox + 1) * src_w / dst_w));
+            uint32_t r = 0, g = 0, b = 0;
+            for (int sx = x0; sx < x1; ++sx) {
+                r += column_sums[sx * 3 + 0];
+                g += column_sums[sx * 3 + 1];
+                b += column_sums[sx * 3 + 2];
+            }
+            uint32_t area = static_cast<uint32_t>((x1 - x0) * (y1 - y0));
+            out[ox * 3 + 0] = static_cast<uint8_t>((r + area / 2) / area);
+            out[ox * 3 + 1] = static_cast<uint8_t>((g + area / 2) / area);
+            out[ox * 3 + 2] = static_cast<uint8_t>((b + area / 2) / area);
+        }
+    }
+}
+
+// Median cut: split the box with the widest channel range at its median until
+// there are `colors` boxes; each box's mean becomes a palette entry
+std::vector<uint32_t> median_cut_palette(const uint8_t* rgb, size_t pixel_count, int colors) {
+    struct Box {
+        size_t begin;
+        size_t end;
+        int channel;  // Widest channel
+        int range;
+    };
+    std::vector<std::array<uint8_t, 3>> samples(pixel_count);
+    for (size_t i = 0; i < pixel_count; ++i) {
+        samples[i] = {rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2]};
+    }
+    
+    auto measure = [&samples](Box& box) {
+        uint8_t lo[3] = {255, 255, 255};
+        uint8_t hi[3] = {0, 0, 0};
+        for (size_t i = box.begin; i < box.end; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                lo[c] = std::min(lo[c], samples[i][c]);
+                hi[c] = std::max(hi[c], samples[i][c]);
+            }
+        }
+        box.channel = 0;
+        box.range = 0;
+        for (int c = 0; c < 3; ++c) {
+            if (hi[c] - lo[c] > box.range) {
+                box.range = hi[c] - lo[c];
+                box.channel = c;
+            }
+        }
+    };
+    
+    std::vector<Box> boxes;
+    if (pixel_count == 0) return {};
+    boxes.push_back({0, pixel_count, 0, 0});
+    measure(boxes[0]);
+    while (static_cast<int>(boxes.size()) < colors) {
+        // Widest box (weighted by population) that can still be split
+        int pick = -1;
+        uint64_t best = 0;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            uint64_t score = static_cast<uint64_t>(boxes[i].range) * (boxes[i].end - boxes[i].begin);
+            if (boxes[i].end - boxes[i].begin >= 2 && score > best) {
+                best = score;
+                pick = static_cast<int>(i);
+            }
+        }
+        if (pick < 0) break;  // Fewer distinct colors than requested
+        
+        Box box = boxes[pick];
+        size_t mid = box.begin + (box.end - box.begin) / 2;
+        int channel = box.channel;
+        std::nth_element(samples.begin() + box.begin, samples.begin() + mid, samples.begin() + box.end,
+                         [channel](const auto& a, const auto& b) { return a[channel] < b[channel]; });
+        Box lower{box.begin, mid, 0, 0};
+        Box upper{mid, box.end, 0, 0};
+        measure(lower);
+        measure(upper);
+        boxes[pick] = lower;
+        boxes.push_back(upper);
+    }
+    
+    std::vector<uint32_t> palette;
+    palette.reserve(boxes.size());
+    for (const auto& box : boxes) {
+        uint64_t sum[3] = {0, 0, 0};
+        for (size_t i = box.begin; i < box.end; ++i) {
+            for (int c = 0; c < 3; ++c) sum[c] += samples[i][c];
+        }
+        uint64_t n = box.end - box.begin;
+        palette.push_back(static_cast<uint32_t>(((sum[0] + n / 2) / n) << 16 |
+                                                ((sum[1] + n / 2) / n) << 8 |
+                                                ((sum[2] + n / 2) / n)));
+    }
+    return palette;
+}
+
+// Closest palette entry (squared RGB distance; palettes are at most a few dozen colors)
+uint32_t nearest_palette_color(const std::vector<uint32_t>& palette, int r, int g, int b) {
+    uint32_t best = palette.front();
+    int best_dist = INT_MAX;
+    for (uint32_t c : palette) {
+        int dr = static_cast<int>(c >> 16) - r;
+        int dg = static_cast<int>((c >> 8) & 0xFF) - g;
+        int db = static_cast<int>(c & 0xFF) - b;
+        int dist = dr * dr + dg * dg + db * db;
+        if (dist < best_dist) {
+            best_dist = dist;
+            best = c;
+        }
+    }
+    return best;
+}
+
+const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+void append_base64(std::string& out, const uint8_t* data, size_t size) {
+    out.reserve(out.size() + (size + 2) / 3 * 4);
+    size_t i = 0;
+    for (; i + 2 < size; i += 3) {
+        uint32_t v = (static_cast<uint32_t>(data[i]) << 16) | (data[i + 1] << 8) | data[i + 2];
+        out += BASE64_CHARS[v >> 18];
+        out += BASE64_CHARS[(v >> 12) & 63];
+        out += BASE64_CHARS[(v >> 6) & 63];
+        out += BASE64_CHARS[v & 63];
+    }
+    if (i < size) {
+        uint32_t v = static_cast<uint32_t>(data[i]) << 16;
+        if (i + 1 < size) v |= data[i + 1] << 8;
+        out += BASE64_CHARS[v >> 18];
+        out += BASE64_CHARS[(v >> 12) & 63];
+        out += i + 1 < size ? BASE64_CHARS[(v >> 6) & 63] : '=';
+        out += '=';
+    }
+}
+
+// Kitty transmit (no display): the image as PNG (raw RGB if encoding fails),
+// base64 in 4096-byte chunks
+std::string encode_kitty(const std::vector<uint8_t>& rgb, int width, int height, uint32_t id) {
+    png_image image;
+    std::memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    image.width = static_cast<png_uint_32>(width);
+    image.height = static_cast<png_uint_32>(height);
+    image.format = PNG_FORMAT_RGB;
+    
+    std::vector<uint8_t> png;
+    png_alloc_size_t png_size = 0;
+    bool is_png = png_image_write_to_memory(&image, nullptr, &png_size, 0, rgb.data(), 0, nullptr) && png_size > 0;
+    if (is_png) {
+        png.resize(png_size);
+        is_png = png_image_write_to_memory(&image, png.data(), &png_size, 0, rgb.data(), 0, nullptr);
+    }
+    png_image_free(&image);
+    
+    std::string encoded;
+    if (is_png) {
+        append_base64(encoded, png.data(), png_size);
+    } else {
+        append_base64(encoded, rgb.data(), rgb.size());
+    }
+    
+    constexpr size_t CHUNK = 4096;
+    std::string out;
+    out.reserve(encoded.size() + encoded.size() / CHUNK * 16 + 96);
+    for (size_t pos = 0; pos < encoded.size(); pos += CHUNK) {
+        bool more = pos + CHUNK < encoded.size();
+        out += "\033_G";
+        if (pos == 0) {
+            out += "a=t,q=2,i=" + std::to_string(id) +
+                   (is_png ? std::string(",f=100,") : ",f=24,s=" + std::to_string(width) + ",v=" + std::to_string(height) + ",");
+        }
+        out += more ? "m=1;" : "m=0;";
+        out.append(encoded, pos, CHUNK);
+        out += "\033\\";
+    }
+    return out;
+}
+
+// Sixel image: 256-register median-cut palette, one pass per color per six-pixel
+// band with run-length compression
+std::string encode_sixel(const std::vector<uint8_t>& rgb, int width, int height) {
+    int sample_w = std::min(width, 96);
+    int sample_h = std::min(height, 96);
+    std::vector<uint8_t> sample(static_cast<size_t>(sample_w) * sample_h * 3);
+    box_downscale(rgb.data(), width, height, sample.data(), sample_w, sample_h);
+    std::vector<uint32_t> palette = median_cut_palette(sample.data(), sample.size() / 3, 256);
+    if (palette.empty()) return {};
+    
+    // Palette index per pixel; an RGB555 memo keeps the nearest-color search to
+    // the distinct colors actually present
+    std::vector<int16_t> memo(32768, -1);
+    std::vector<uint8_t> index(static_cast<size_t>(width) * height);
+    for (size_t i = 0; i < index.size(); ++i) {
+        const uint8_t* p = &rgb[i * 3];
+        size_t key = (p[0] >> 3) << 10 | (p[1] >> 3) << 5 | (p[2] >> 3);
+        if (memo[key] < 0) {
+            uint32_t c = nearest_palette_color(palette, p[0], p[1], p[2]);
+            memo[key] = static_cast<int16_t>(std::find(palette.begin(), palette.end(), c) - palette.begin());
+        }
+        index[i] = static_cast<uint8_t>(memo[key]);
+    }
+    
+    std::string out = "\033Pq\"1;1;";
+    out += std::to_string(width);
+    out += ';';
+    out += std::to_string(height);
+    for (size_t i = 0; i < palette.size(); ++i) {
+        uint32_t c = palette[i];
+        out += '#';
+        out += std::to_string(i);
+        out += ";2;";
+        out += std::to_string(((c >> 16) * 100 + 127) / 255);
+        out += ';';
+        out += std::to_string((((c >> 8) & 0xFF) * 100 + 127) / 255);
+        out += ';';
+        out += std::to_string(((c & 0xFF) * 100 + 127) / 255);
+    }
+    
+    std::vector<uint8_t> bits(palette.size() * width);
+    std::vector<bool> used(palette.size());
+    auto emit_run = [&out](char ch, int count) {
+        if (count > 3) {
+            out += '!';
+            out += std::to_string(count);
+            out += ch;
+        } else {
+            out.append(static_cast<size_t>(count), ch);
+        }
+    };
+    for (int band = 0; band < height; band += 6) {
+        std::fill(bits.begin(), bits.end(), 0);
+        std::fill(used.begin(), used.end(), false);
+        for (int r = 0; r < 6 && band + r < height; ++r) {
+            const uint8_t* row = &index[static_cast<size_t>(band + r) * width];
+            for (int x = 0; x < width; ++x) {
+                bits[static_cast<size_t>(row[x]) * width + x] |= static_cast<uint8_t>(1 << r);
+                used[row[x]] = true;
+            }
+        }
+        
+        bool first = true;
+        for (size_t c = 0; c < palette.size(); ++c) {
+            if (!used[c]) continue;
+            if (!first) out += '$';  // Back to the start of the band for the next color
+            first = false;
+            out += '#';
+            out += std::to_string(c);
+            const uint8_t* sixels = &bits[c * width];
+            int end = width;
+            while (end > 0 && sixels[end - 1] == 0) --end;  // Trailing blanks are implicit
+            char run_char = 0;
+            int run = 0;
+            for (int x = 0; x < end; ++x) {
+                char ch = static_cast<char>('?' + sixels[x]);
+                if (ch == run_char) {
+                    ++run;
+                    continue;
+                }
+                if (run) emit_run(run_char, run);
+                run_char = ch;
+                run = 1;
+            }
+            if (run) emit_run(run_char, run);
+        }
+        out += '-';
+    }
+    out += "\033\\";
+    return out;
+}
+
+// 4x4 Bayer matrix for ordered dithering (stable between frames, unlike error diffusion)
+constexpr int BAYER_4X4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5},
+};
+
+} // namespace
+
 // AlbumArt implementation
+ArtCache* AlbumArt::disk_cache = nullptr;
+int AlbumArt::palette_colors = 0;
+bool AlbumArt::palette_dither = false;
+GraphicsProtocol AlbumArt::graphics_protocol = GraphicsProtocol::None;
+int AlbumArt::cell_px_w = 0;
+int AlbumArt::cell_px_h = 0;
+std::atomic<uint32_t> AlbumArt::next_kitty_id{1};
+uint64_t AlbumArt::upload_epoch = 1;
+std::mutex AlbumArt::retired_mutex;
+std::vector<uint32_t> AlbumArt::retired_ids;
+
+void AlbumArt::set_palette(int colors, bool dither) {
+    palette_colors = colors > 0 ? std::clamp(colors, 2, 256) : 0;
+    palette_dither = dither;
+}
+
+void AlbumArt::build_palette() {
+    palette.clear();
+    if (palette_colors <= 0 || decoded_rgb.empty()) return;
+    
+    // A thumbnail of the image is plenty to choose colors from
+    int sample_w = std::min(image_width, 64);
+    int sample_h = std::min(image_height, 64);
+    std::vector<uint8_t> sample(static_cast<size_t>(sample_w) * sample_h * 3);
+    box_downscale(decoded_rgb.data(), image_width, image_height, sample.data(), sample_w, sample_h);
+    palette = median_cut_palette(sample.data(), static_cast<size_t>(sample_w) * sample_h, palette_colors);
+}
+
+void AlbumArt::quantize(std::vector<std::vector<uint8_t>>& pixels) const {
+    if (palette.empty()) return;
+    // Dither amplitude about one palette step (a cube-root share of each channel)
+    int spread = palette_dither ? static_cast<int>(256 / std::cbrt(static_cast<double>(palette.size()))) : 0;
+    for (size_t y = 0; y < pixels.size(); ++y) {
+        auto& row = pixels[y];
+        for (size_t x = 0; x + 2 < row.size(); x += 3) {
+            int offset = spread ? (BAYER_4X4[y & 3][(x / 3) & 3] * 2 - 15) * spread / 32 : 0;
+            uint32_t c = nearest_palette_color(palette, row[x] + offset, row[x + 1] + offset, row[x + 2] + offset);
+            row[x] = static_cast<uint8_t>(c >> 16);
+            row[x + 1] = static_cast<uint8_t>(c >> 8);
+            row[x + 2] = static_cast<uint8_t>(c);
+        }
+    }
+}
+
 AlbumArt::AlbumArt() {
     // Constructor - nothing to initialize
 }
 
-bool AlbumArt::fetch_art(const std::string& plex_server, const std::string& token,
-                         const std::string& art_url) {
-    clear();
+AlbumArt::~AlbumArt() {
+    if (kitty_id != 0 && uploaded_epoch != 0) {
+        std::lock_guard<std::mutex> lock(retired_mutex);
+        retired_ids.push_back(kitty_id);
+    }
+}
+
+void AlbumArt::set_graphics(GraphicsProtocol protocol, int px_w, int px_h) {
+    graphics_protocol = protocol;
+    cell_px_w = px_w;
+    cell_px_h = px_h;
+}
+
+void AlbumArt::invalidate_uploads() {
+    ++upload_epoch;
+}
+
+void AlbumArt::append_retired_images(std::string& out) {
+    std::lock_guard<std::mutex> lock(retired_mutex);
+    for (uint32_t id : retired_ids) {
+        out += "\033_Ga=d,d=I,q=2,i=" + std::to_string(id) + "\033\\";
+    }
+    retired_ids.clear();
+}
+
+void AlbumArt::prepare_graphics(int width, int height) {
+    if (graphics_protocol == GraphicsProtocol::None || !has_art() || width <= 0 || height <= 0) return;
+    if (!graphics_payload.empty() && graphics_width == width && graphics_height == height &&
+        graphics_generation == art_generation) {
+        return;
+    }
+    graphics_width = width;
+    graphics_height = height;
+    graphics_generation = art_generation;
     
-    std::string full_url = art_url;
-    if (full_url.find("http") != 0) {
-        // Relative URL, prepend server
-        if (full_url[0] != '/') {
-            full_url = "/" + full_url;
-        }
-        full_url = plex_server + full_url;
+    // Kitty scales to the cell rect itself, so an unknown cell size only costs
+    // sharpness; sixel pixels are final
+    int px_w = width * (cell_px_w > 0 ? cell_px_w : 10);
+    int px_h = height * (cell_px_h > 0 ? cell_px_h : 20);
+    px_w = std::min(px_w, 1024);
+    px_h = std::min(px_h, 1024);
+    if (graphics_protocol == GraphicsProtocol::Sixel) {
+        px_h -= px_h % 6;  // Whole sixel bands: the image never spills into the row below
     }
     
-    // Add token
-    if (full_url.find('?') != std::string::npos) {
-        full_url += "&X-Plex-Token=" + token;
-    } else {
-        full_url += "?X-Plex-Token=" + token;
+    // Same aspect fit and black padding as the half-block renderer
+    auto rows = pixelate_image(px_w, px_h);
+    std::vector<uint8_t> rgb;
+    rgb.reserve(static_cast<size_t>(px_w) * px_h * 3);
+    for (const auto& row : rows) {
+        rgb.insert(rgb.end(), row.begin(), row.end());
     }
     
-    return download_image(full_url, token);
+    if (graphics_protocol == GraphicsProtocol::Kitty) {
+        if (kitty_id == 0) {
+            kitty_id = next_kitty_id++;
+        }
+        graphics_payload = encode_kitty(rgb, px_w, px_h, kitty_id);
+        uploaded_epoch = 0;  // New pixels - must be sent again
+    } else {
+        graphics_payload = encode_sixel(rgb, px_w, px_h);
+    }
 }
 
-bool AlbumArt::download_image(const std::string& url, const std::string& token) {
-    // Use curl to download image
-    // For simplicity, we'll use a system call to curl
-    // In production, use libcurl directly
+const std::string& AlbumArt::render_graphics(int width, int height) {
+    prepare_graphics(width, height);
+    graphics_output.clear();
+    if (graphics_payload.empty()) return graphics_output;
     
-    std::string cmd = "curl -s -H 'X-Plex-Token: " + token + "' '" + url + "'";
+    if (graphics_protocol == GraphicsProtocol::Sixel) {
+        return graphics_payload;
+    }
     
-    FILE* pipe = popen(cmd.c_str(), "r");
-    if (!pipe) {
+    // Kitty: upload once, then every draw is a placement of the stored image
+    // scaled into the cell rect (placement id 1 moves rather than duplicates it)
+    if (uploaded_epoch != upload_epoch) {
+        graphics_output = graphics_payload;
+        uploaded_epoch = upload_epoch;
+    }
+    graphics_output += "\033_Ga=p,q=2,C=1,p=1,i=" + std::to_string(kitty_id) + ",c=" + std::to_string(width) +
+                       ",r=" + std::to_string(height) + "\033\\";
+    return graphics_output;
+}
+
+bool AlbumArt::fetch_art(const std::string& plex_server, const std::string& token,
+                         const std::string& art_url) {
+    if (art_url.empty()) {
+        clear();
         return false;
     }
     
-    char buffer[4096];
-    size_t bytes_read;
+    // Server-relative path of the artwork (empty for images hosted elsewhere)
+    std::string path;
+    if (art_url.find("http") != 0) {
+        path = (art_url[0] == '/') ? art_url : "/" + art_url;
+    } else if (!plex_server.empty() && art_url.compare(0, plex_server.length(), plex_server) == 0) {
+        path = art_url.substr(plex_server.length());
+    }
     
-    while ((bytes_read = fread(buffer, 1, sizeof(buffer), pipe)) > 0) {
-        art_data.insert(art_data.end(), buffer, buffer + bytes_read);
+    std::string request;  // Identifies the image (and size) - the cache key
+    if (!path.empty() && display_w > 0 && display_h > 0) {
+        // Let the server scale: 2x the half-block pixel grid (w x 2h), or the real
+        // pixel size for graphics protocols, rounded up to 64px steps so small
+        // layout changes still hit the same cached size
+        auto bucket = [](int px) { return std::clamp((px + 63) / 64 * 64, 64, 1024); };
+        bool pixels = graphics_protocol != GraphicsProtocol::None;
+        int want_w = display_w * (pixels ? (cell_px_w > 0 ? cell_px_w : 10) : 2);
+        int want_h = display_h * (pixels ? (cell_px_h > 0 ? cell_px_h : 20) : 4);
+        request = plex_server + "/photo/:/transcode?width=" + std::to_string(bucket(want_w)) +
+                   "&height=" + std::to_string(bucket(want_h)) +
+                   "&minSize=1&upscale=0&url=" + url_encode(path);
+    } else {
+        request = path.empty() ? art_url : plex_server + path;
     }
     
-    pclose(pipe);
+    // Same image at the same size is already decoded
+    if (request == loaded_url && has_art()) {
+        return true;
+    }
+    clear();
     
-    if (art_data.empty()) {
+    // Previously seen art comes from the disk cache without touching the network
+    bool ok = false;
+    if (disk_cache && disk_cache->load(request, art_data)) {
+        ok = decode_image();
+        if (!ok) {
+            disk_cache->remove(request);
+            art_data.clear();
+        }
+    }
+    
+    if (!ok) {
+        // Add token
+        std::string full_url = request;
+        if (full_url.find('?') != std::string::npos) {
+            full_url += "&X-Plex-Token=" + token;
+        } else {
+            full_url += "?X-Plex-Token=" + token;
+        }
+        ok = download_image(full_url, token, request);
+    }
+    
+    if (ok) {
+        loaded_url = request;
+    }
+    ++art_generation;
+    return ok;
+}
+
+bool AlbumArt::download_image(const std::string& url, const std::string& token, const std::string& cache_key) {
+    // Pooled connection: successive covers reuse the open connection to the server
+    std::string body;
+    long status = 0;
+    if (!HttpPool::instance().get(url, {"X-Plex-Token: " + token}, 10L, body, &status, nullptr, false) ||
+        status < 200 || status >= 300 || body.empty()) {
         return false;
     }
+    art_data.assign(body.begin(), body.end());
     
-    // Try to decode image
-    return decode_image();
+    // Try to decode image - only images that decode are cached (error pages aren't)
+    std::vector<uint8_t> compressed;
+    if (disk_cache) {
+        compressed = art_data;  // decode_image() releases art_data
+    }
+    if (!decode_image()) {
+        return false;
+    }
+    if (disk_cache) {
+        disk_cache->store(cache_key, compressed);
+    }
+    return true;
 }
 
 bool AlbumArt::decode_image() {
-    // Simple approach: use ImageMagick or similar to convert to text
-    // For now, we'll create a placeholder that uses system tools
+    // Decode once into decoded_rgb; every render size is scaled from memory
+    decoded_rgb.clear();
+    image_width = 0;
+    image_height = 0;
+    if (art_data.size() < 8) return false;
     
-    // Write to temp file
-    std::string temp_file = "/tmp/plex_art_" + std::to_string(getpid()) + ".jpg";
-    std::ofstream out(temp_file, std::ios::binary);
-    if (!out) {
+    bool ok = false;
+    const uint8_t* data = art_data.data();
+    if (data[0] == 0xFF && data[1] == 0xD8) {
+        // Half blocks use a few hundred pixels at most; graphics protocols show real pixels
+        unsigned min_side = graphics_protocol == GraphicsProtocol::None ? 256 : 1024;
+        ok = decode_jpeg(art_data, decoded_rgb, image_width, image_height, min_side);
+    } else if (png_sig_cmp(data, 0, 8) == 0) {
+        ok = decode_png(art_data, decoded_rgb, image_width, image_height);
+    }
+    if (!ok) {
+        decoded_rgb.clear();
+        image_width = 0;
+        image_height = 0;
         return false;
     }
-    out.write(reinterpret_cast<const char*>(art_data.data()), art_data.size());
-    out.close();
-    
-    // Use ImageMagick or ffmpeg to get dimensions and convert
-    // For now, assume we can get basic info
-    // In production, use a proper image library like stb_image
     
-    // Placeholder: return true if we have data
-    // Real implementation would decode JPEG/PNG here
-    return !art_data.empty();
+    // The compressed bytes aren't needed once decoded
+    std::vector<uint8_t>().swap(art_data);
+    build_palette();
+    return true;
 }
 
 std::vector<std::vector<uint8_t>> AlbumArt::pixelate_image(int width, int height) {
     std::vector<std::vector<uint8_t>> result(height);
     
-    if (art_data.empty()) {
+    if (decoded_rgb.empty()) {
         // No image data - return gradient placeholder
         for (int y = 0; y < height; ++y) {
             result[y].resize(width * 3);
@@ -787,204 +1355,113 @@ std::vector<std::vector<uint8_t>> AlbumArt::pixelate_image(int width, int height
         return result;
     }
     
-    // Use ffmpeg to decode and resize image to pixelated size
-    // Use unique temp files with timestamp to avoid conflicts
-    auto now = std::chrono::steady_clock::now();
-    auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()).count();
-    std::string temp_in = "/tmp/plex_art_in_" + std::to_string(getpid()) + "_" + std::to_string(timestamp) + ".jpg";
-    std::string temp_out = "/tmp/plex_art_out_" + std::to_string(getpid()) + "_" + std::to_string(timestamp) + ".raw";
-    
-    {
-        std::ofstream out(temp_in, std::ios::binary);
-        if (!out) {
-            // Fallback to gradient
-            for (int y = 0; y < height; ++y) {
-                result[y].resize(width * 3);
-                for (int x = 0; x < width; ++x) {
-                    result[y][x * 3 + 0] = 100;
-                    result[y][x * 3 + 1] = 100;
-                    result[y][x * 3 + 2] = 100;
-                }
-            }
-            return result;
-        }
-        out.write(reinterpret_cast<const char*>(art_data.data()), art_data.size());
-    }
-    
-    // Use ffmpeg to resize and convert to raw RGB
-    // Use -y flag to auto-overwrite (just in case)
-    pid_t pid = fork();
-    if (pid == 0) {
-        // Child: run ffmpeg
-        int fd = open(temp_out.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
-        if (fd >= 0) {
-            dup2(fd, STDOUT_FILENO);
-            close(fd);
-        }
-        
-        // Build video filter: 
-        // 1. Scale to higher res first (2x) for better quality, then downscale
-        // 2. Scale to target size maintaining aspect ratio
-        // 3. Pad to square
-        int scale_w = width * 2;  // Render at 2x for better quality
-        int scale_h = height * 2;
-        std::string vf = "scale=" + std::to_string(scale_w) + ":" + std::to_string(scale_h) + 
-                        ":force_original_aspect_ratio=decrease:flags=lanczos," +
-                        "scale=" + std::to_string(width) + ":" + std::to_string(height) + 
-                        ":flags=neighbor," +  // Use neighbor for pixelated look
-                        "pad=" + std::to_string(width) + ":" + std::to_string(height) + 
-                        ":(ow-iw)/2:(oh-ih)/2:black";
-        
-        // Create C-style strings that will persist during exec
-        std::string in_file = temp_in;
-        std::string out_file = temp_out;
-        std::string vf_str = vf;
-        std::string in_copy = in_file;
-        std::string out_copy = out_file;
-        std::string vf_copy = vf_str;
-        
-        char in_buf[512];
-        char out_buf[512];
-        char vf_buf[1024];
-        strncpy(in_buf, in_copy.c_str(), sizeof(in_buf) - 1);
-        in_buf[sizeof(in_buf) - 1] = '\0';
-        strncpy(out_buf, out_copy.c_str(), sizeof(out_buf) - 1);
-        out_buf[sizeof(out_buf) - 1] = '\0';
-        strncpy(vf_buf, vf_copy.c_str(), sizeof(vf_buf) - 1);
-        vf_buf[sizeof(vf_buf) - 1] = '\0';
-        
-        char* args[] = {
-            const_cast<char*>("ffmpeg"),
-            const_cast<char*>("-y"),  // Auto-overwrite output file
-            const_cast<char*>("-i"),
-            in_buf,
-            const_cast<char*>("-vf"),
-            vf_buf,
-            const_cast<char*>("-f"),
-            const_cast<char*>("rawvideo"),
-            const_cast<char*>("-pix_fmt"),
-            const_cast<char*>("rgb24"),
-            const_cast<char*>("-loglevel"),
-            const_cast<char*>("quiet"),
-            out_buf,
-            nullptr
-        };
-        
-        execvp("ffmpeg", args);
-        _exit(1);
-    } else if (pid > 0) {
-        // Parent: wait for ffmpeg and read result
-        int status = 0;
-        waitpid(pid, &status, 0);
-        
-        // Check if ffmpeg succeeded
-        if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
-            // Read raw RGB data
-            std::ifstream in(temp_out, std::ios::binary);
-            if (in && in.good()) {
-                for (int y = 0; y < height; ++y) {
-                    result[y].resize(width * 3);
-                    in.read(reinterpret_cast<char*>(result[y].data()), width * 3);
-                    if (!in || in.gcount() < width * 3) {
-                        // Read failed or incomplete - fill with gray
-                        for (int x = 0; x < width; ++x) {
-                            result[y][x * 3 + 0] = 128;
-                            result[y][x * 3 + 1] = 128;
-                            result[y][x * 3 + 2] = 128;
-                        }
-                    }
-                }
-                in.close();
-            } else {
-                // File read failed - use gray
-                for (int y = 0; y < height; ++y) {
-                    result[y].resize(width * 3);
-                    for (int x = 0; x < width; ++x) {
-                        result[y][x * 3 + 0] = 128;
-                        result[y][x * 3 + 1] = 128;
-                        result[y][x * 3 + 2] = 128;
-                    }
-                }
-            }
-        } else {
-            // ffmpeg failed - use gray placeholder
-            for (int y = 0; y < height; ++y) {
-                result[y].resize(width * 3);
-                for (int x = 0; x < width; ++x) {
-                    result[y][x * 3 + 0] = 128;
-                    result[y][x * 3 + 1] = 128;
-                    result[y][x * 3 + 2] = 128;
-                }
-            }
-        }
-        
-        // Cleanup temp files (ignore errors - files might not exist)
-        unlink(temp_in.c_str());
-        unlink(temp_out.c_str());
-    } else {
-        // Fork failed - use gradient
-        for (int y = 0; y < height; ++y) {
-            result[y].resize(width * 3);
-            for (int x = 0; x < width; ++x) {
-                result[y][x * 3 + 0] = 100;
-                result[y][x * 3 + 1] = 100;
-                result[y][x * 3 + 2] = 100;
-            }
-        }
+    // Fit inside width x height keeping the aspect ratio, centered on black
+    int fit_w = width;
+    int fit_h = static_cast<int>(static_cast<int64_t>(image_height) * width / image_width);
+    if (fit_h > height) {
+        fit_h = height;
+        fit_w = static_cast<int>(static_cast<int64_t>(image_width) * height / image_height);
+    }
+    fit_w = std::clamp(fit_w, 1, std::max(1, width));
+    fit_h = std::clamp(fit_h, 1, std::max(1, height));
+    
+    std::vector<uint8_t> scaled(static_cast<size_t>(fit_w) * fit_h * 3);
+    box_downscale(decoded_rgb.data(), image_width, image_height, scaled.data(), fit_w, fit_h);
+    
+    int pad_x = (width - fit_w) / 2;
+    int pad_y = (height - fit_h) / 2;
+    for (int y = 0; y < height; ++y) {
+        result[y].assign(static_cast<size_t>(width) * 3, 0);
+        int sy = y - pad_y;
+        if (sy < 0 || sy >= fit_h) continue;
+        std::memcpy(result[y].data() + pad_x * 3, scaled.data() + static_cast<size_t>(sy) * fit_w * 3,
+                    static_cast<size_t>(fit_w) * 3);
     }
     
     return result;
 }
 
-std::vector<std::string> AlbumArt::render_pixelated(int width, int height, const Theme& /*theme*/) {
+const std::vector<std::string>& AlbumArt::render_pixelated(int width, int height, const Theme& /*theme*/) {
+    if (!rendered_lines.empty() && rendered_width == width && rendered_height == height) {
+        return rendered_lines;
+    }
+    rendered_lines.clear();
+    rendered_width = width;
+    rendered_height = height;
+    
     if (!has_art()) {
         // Return empty placeholder
-        return std::vector<std::string>(height, std::string(width, ' '));
+        rendered_lines.assign(height, std::string(width, ' '));
+        return rendered_lines;
     }
     
-    auto pixels = pixelate_image(width, height);
-    std::vector<std::string> result;
-    result.reserve(height);
+    // Half-block rendering: each cell shows two vertically stacked pixels, the
+    // upper one as the foreground of "▀" and the lower one as the background
+    auto pixels = pixelate_image(width, height * 2);
+    quantize(pixels);  // Flat palette regions collapse into single-escape runs
+    rendered_lines.reserve(height);
     
-    // Use block characters for pixelated effect
-    // Each character represents one "pixel"
-    const char* block_chars[] = {" ", "░", "▒", "▓", "█"};
+    auto pixel_at = [&pixels](int px, int py) -> uint32_t {
+        // Out of bounds - black pixel
+        if (py >= static_cast<int>(pixels.size()) || px * 3 + 2 >= static_cast<int>(pixels[py].size())) {
+            return 0;
+        }
+        const uint8_t* p = &pixels[py][px * 3];
+        return (static_cast<uint32_t>(p[0]) << 16) | (static_cast<uint32_t>(p[1]) << 8) | p[2];
+    };
     
     for (int y = 0; y < height; ++y) {
         std::string row;
-        row.reserve(width * 25);  // Approximate for ANSI codes
+        row.reserve(width * 12);  // Runs of equal color share one escape
+        
+        // Colors already in effect on this row (-1 = none yet); escapes are only
+        // emitted when a color actually changes
+        int64_t cur_fg = -1;
+        int64_t cur_bg = -1;
+        auto set_fg = [&row, &cur_fg](uint32_t c) {
+            if (cur_fg == c) return;
+            Terminal::append_fg(row, static_cast<uint8_t>(c >> 16), static_cast<uint8_t>(c >> 8), static_cast<uint8_t>(c));
+            cur_fg = c;
+        };
+        auto set_bg = [&row, &cur_bg](uint32_t c) {
+            if (cur_bg == c) return;
+            Terminal::append_bg(row, static_cast<uint8_t>(c >> 16), static_cast<uint8_t>(c >> 8), static_cast<uint8_t>(c));
+            cur_bg = c;
+        };
         
         for (int x = 0; x < width; ++x) {
-            // Bounds check to prevent crashes
-            if (y >= static_cast<int>(pixels.size()) || 
-                x * 3 + 2 >= static_cast<int>(pixels[y].size())) {
-                // Out of bounds - use gray pixel
-                row += " ";
-                continue;
+            uint32_t top = pixel_at(x, y * 2);
+            uint32_t bottom = pixel_at(x, y * 2 + 1);
+            if (top == bottom) {
+                // Solid cell: a blank on the background needs no foreground change
+                set_bg(top);
+                row += ' ';
+            } else {
+                set_fg(top);
+                set_bg(bottom);
+                row += "▀";
             }
-            
-            uint8_t r = pixels[y][x * 3 + 0];
-            uint8_t g = pixels[y][x * 3 + 1];
-            uint8_t b = pixels[y][x * 3 + 2];
-            
-            // btop style: Use foreground color on black background for pixelated look
-            // Use simple ANSI codes (Terminal class will be used by caller)
-            std::string black_bg = "\033[48;2;0;0;0m";
-            std::string fg_color = "\033[38;2;" + std::to_string(r) + ";" + 
-                                  std::to_string(g) + ";" + std::to_string(b) + "m";
-            row += black_bg + fg_color + "█" + "\033[0m";
         }
+        row += "\033[0m";
         
-        result.push_back(row);
+        rendered_lines.push_back(std::move(row));
     }
     
-    return result;
+    return rendered_lines;
 }
 
 void AlbumArt::clear() {
+    ++art_generation;
+    loaded_url.clear();
     art_data.clear();
+    rendered_lines.clear();
+    rendered_width = 0;
+    rendered_height = 0;
     decoded_rgb.clear();
+    palette.clear();
+    graphics_payload.clear();
+    graphics_width = 0;
+    graphics_height = 0;
     image_width = 0;
     image_height = 0;
 }
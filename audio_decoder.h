@@ -1,6 +1,7 @@
 #pragma once
 
 #include "types.h"
+#include "terminal.h"
 #include <vector>
 #include <string>
 #include <memory>
@@ -10,6 +11,8 @@
 
 namespace PlexTUI {
 
+class ArtCache;
+
 /**
  * Audio decoder for client-side waveform generation
  * Decodes audio streams and extracts PCM data for visualization
@@ -72,36 +75,110 @@ private:
 class AlbumArt {
 public:
     AlbumArt();
+    ~AlbumArt();
+    AlbumArt(const AlbumArt&) = delete;
+    AlbumArt& operator=(const AlbumArt&) = delete;
     
     // Fetch album art from Plex API
+    // Server artwork is requested through Plex's photo transcoder at the size the
+    // display needs (see set_display_size); refetching what is loaded is free
     bool fetch_art(const std::string& plex_server, const std::string& token, 
                    const std::string& art_url);
     
-    // Render pixelated album art to terminal
+    // Shared on-disk cache for downloaded images (nullptr = always download)
+    static void set_disk_cache(ArtCache* cache) { disk_cache = cache; }
+    
+    // Reduce rendered art to a per-image palette of `colors` (0 = full color),
+    // optionally with ordered dithering; set once at startup
+    static void set_palette(int colors, bool dither);
+    
+    // Cells the art will be drawn into (0 = fetch the original image)
+    void set_display_size(int cells_w, int cells_h) {
+        display_w = cells_w;
+        display_h = cells_h;
+    }
+    
+    // Render pixelated album art to terminal (half blocks: width x height*2 pixels)
     // Returns the rendered art as a vector of colored strings
-    std::vector<std::string> render_pixelated(int width, int height, 
-                                              const Theme& theme);
+    // (cached per size - redrawing the same art costs no decode or allocation)
+    const std::vector<std::string>& render_pixelated(int width, int height, 
+                                                     const Theme& theme);
+    
+    // Pixel graphics instead of half blocks (process-wide, set once at startup
+    // before any art is fetched; cell size 0 = unknown)
+    static void set_graphics(GraphicsProtocol protocol, int cell_px_w, int cell_px_h);
+    static GraphicsProtocol graphics() { return graphics_protocol; }
     
-    // Check if art is loaded
-    bool has_art() const { return !art_data.empty(); }
+    // Encode the image for a width x height cell rect (cached per size; safe to
+    // call off the UI thread, e.g. from the art loader)
+    void prepare_graphics(int width, int height);
+    
+    // Escapes that show the art in a width x height cell rect whose top-left
+    // corner is at the cursor. Kitty: the first call carries the image, later
+    // calls only re-place it by id. Sixel: the cached encoded image.
+    const std::string& render_graphics(int width, int height);
+    
+    // Kitty: the terminal may have lost uploads (dropped frame) - send them again
+    static void invalidate_uploads();
+    // Kitty: append deletes for images whose AlbumArt is gone (frees terminal memory)
+    static void append_retired_images(std::string& out);
+    
+    // Check if art is loaded (and decoded)
+    bool has_art() const { return !decoded_rgb.empty(); }
+    
+    // Bumped whenever the image changes (lets views skip redrawing unchanged art)
+    uint32_t generation() const { return art_generation; }
     
     // Clear loaded art
     void clear();
     
 private:
-    // Download image data
-    bool download_image(const std::string& url, const std::string& token);
+    // Download image data (stored in the disk cache under cache_key once it decodes)
+    bool download_image(const std::string& url, const std::string& token, const std::string& cache_key);
     
-    // Convert image to pixelated representation
+    // Scale the decoded image to width x height RGB rows (aspect kept, black padding)
     std::vector<std::vector<uint8_t>> pixelate_image(int width, int height);
     
-    std::vector<uint8_t> art_data;  // Raw image data (JPEG/PNG)
+    std::vector<uint8_t> art_data;  // Raw image data (JPEG/PNG), released once decoded
+    uint32_t art_generation = 0;
+    std::string loaded_url;  // Request (including transcode size) of the loaded image
+    static ArtCache* disk_cache;
+    int display_w = 0;
+    int display_h = 0;
     int image_width = 0;
     int image_height = 0;
     
-    // Use stb_image for decoding (or fallback to system tools)
+    // Decode art_data in-process (libjpeg / libpng)
     bool decode_image();
     std::vector<uint8_t> decoded_rgb;  // RGB24 data
+    
+    // Median-cut palette, built once per decoded image (empty = full color)
+    void build_palette();
+    void quantize(std::vector<std::vector<uint8_t>>& pixels) const;
+    std::vector<uint32_t> palette;  // 0xRRGGBB
+    static int palette_colors;
+    static bool palette_dither;
+    
+    // Last render, reused while size and image are unchanged
+    std::vector<std::string> rendered_lines;
+    int rendered_width = 0;
+    int rendered_height = 0;
+    
+    // Graphics protocol payload (kitty upload or sixel image) for one cell size
+    std::string graphics_payload;
+    std::string graphics_output;  // What render_graphics returned last
+    int graphics_width = 0;
+    int graphics_height = 0;
+    uint32_t graphics_generation = 0;
+    uint32_t kitty_id = 0;        // Terminal-side image id (0 = never uploaded)
+    uint64_t uploaded_epoch = 0;  // upload_epoch when the payload was last sent
+    static GraphicsProtocol graphics_protocol;
+    static int cell_px_w;
+    static int cell_px_h;
+    static std::atomic<uint32_t> next_kitty_id;
+    static uint64_t upload_epoch;
+    static std::mutex retired_mutex;
+    static std::vector<uint32_t> retired_ids;
 };
 
 } // namespace PlexTUI
@@ -48,11 +48,20 @@ bool Config::load_from_file(const std::string& path) {
         if (section == "plex") {
             if (key == "server_url") plex_server_url = value;
             else if (key == "token") plex_token = value;
+            else if (key == "parallel_pages") parallel_pages = std::stoi(value);
         } else if (section == "display") {
             if (key == "max_waveform_points") max_waveform_points = std::stoi(value);
             else if (key == "refresh_rate_ms") refresh_rate_ms = std::stoi(value);
             else if (key == "window_width") window_width = std::stoi(value);
             else if (key == "window_height") window_height = std::stoi(value);
+            else if (key == "color_mode") color_mode = value;
+            else if (key == "art_palette") art_palette = std::stoi(value);
+            else if (key == "art_protocol") art_protocol = value;
+            else if (key == "art_dither") {
+                std::string lower_value = value;
+                std::transform(lower_value.begin(), lower_value.end(), lower_value.begin(), ::tolower);
+                art_dither = (lower_value == "true" || lower_value == "1" || lower_value == "yes" || lower_value == "on");
+            }
         } else if (section == "features") {
             // Parse boolean values (true/false, 1/0, yes/no, on/off)
             bool bool_value = false;
@@ -68,6 +77,13 @@ bool Config::load_from_file(const std::string& path) {
             else if (key == "enable_album_data") enable_album_data = bool_value;
             else if (key == "enable_debug_logging") enable_debug_logging = bool_value;
             else if (key == "debug_log_file_path") debug_log_file_path = value;
+        } else if (section == "cache") {
+            if (key == "art_cache_mb") art_cache_mb = std::stoi(value);
+            else if (key == "library_sync") {
+                std::string lower_value = value;
+                std::transform(lower_value.begin(), lower_value.end(), lower_value.begin(), ::tolower);
+                library_sync = (lower_value == "true" || lower_value == "1" || lower_value == "yes" || lower_value == "on");
+            }
         }
         // PLACEHOLDER: Parse theme colors, keybindings, etc.
     }
@@ -85,13 +101,18 @@ bool Config::save_to_file(const std::string& path) {
     
     file << "[plex]\n";
     file << "server_url = " << plex_server_url << "\n";
-    file << "token = " << plex_token << "\n\n";
+    file << "token = " << plex_token << "\n";
+    file << "parallel_pages = " << parallel_pages << "\n\n";
     
     file << "[display]\n";
     file << "max_waveform_points = " << max_waveform_points << "\n";
     file << "refresh_rate_ms = " << refresh_rate_ms << "\n";
     file << "window_width = " << window_width << "\n";
-    file << "window_height = " << window_height << "\n\n";
+    file << "window_height = " << window_height << "\n";
+    file << "color_mode = " << color_mode << "\n";
+    file << "art_protocol = " << art_protocol << "\n";
+    file << "art_palette = " << art_palette << "\n";
+    file << "art_dither = " << (art_dither ? "true" : "false") << "\n\n";
     
     file << "[features]\n";
     file << "# Enable/disable features\n";
@@ -105,6 +126,10 @@ bool Config::save_to_file(const std::string& path) {
     }
     file << "\n";
     
+    file << "[cache]\n";
+    file << "art_cache_mb = " << art_cache_mb << "\n";
+    file << "library_sync = " << (library_sync ? "true" : "false") << "\n\n";
+    
     // PLACEHOLDER: Save theme, keybindings, etc.
     
     return true;
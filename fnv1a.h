@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string_view>
+#include <cstdint>
+
+namespace PlexTUI {
+
+// FNV-1a: stable across runs and platforms (std::hash is neither), so it can
+// name files and fill on-disk tables
+inline uint64_t fnv1a_64(std::string_view text) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char c : text) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+} // namespace PlexTUI
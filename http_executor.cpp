@@ -0,0 +1,250 @@
+#include "http_executor.h"
+#include "http_pool.h"
+#include <memory>
+#include <strings.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+namespace PlexTUI {
+
+struct HttpExecutor::Transfer {
+    uint64_t id = 0;
+    CURL* easy = nullptr;
+    curl_slist* headers = nullptr;
+    std::string url;
+    Response response;
+    Handler on_done;
+
+    ~Transfer() {
+        if (easy) curl_easy_cleanup(easy);
+        if (headers) curl_slist_free_all(headers);
+    }
+
+    static size_t write_callback(void* contents, size_t size, size_t nmemb, void* userp) {
+        static_cast<std::string*>(userp)->append(static_cast<char*>(contents), size * nmemb);
+        return size * nmemb;
+    }
+};
+
+HttpExecutor::HttpExecutor() {
+    if (pipe(wake_pipe) == 0) {
+        for (int fd : wake_pipe) {
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+    }
+    multi = curl_multi_init();
+    if (multi) {
+        curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    }
+    io_thread = std::thread(&HttpExecutor::io_loop, this);
+}
+
+HttpExecutor::~HttpExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+    }
+    notify_io();
+    if (io_thread.joinable()) {
+        io_thread.join();
+    }
+    if (multi) curl_multi_cleanup(multi);
+    for (int fd : wake_pipe) {
+        if (fd >= 0) close(fd);
+    }
+}
+
+uint64_t HttpExecutor::submit(const std::string& url, std::vector<std::string> headers, Handler on_done) {
+    uint64_t id;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        id = next_id++;
+        submitted.push_back({id, url, std::move(headers), std::move(on_done)});
+    }
+    notify_io();
+    return id;
+}
+
+void HttpExecutor::cancel(uint64_t id) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = submitted.begin(); it != submitted.end(); ++it) {
+            if (it->id == id) {
+                submitted.erase(it);
+                return;  // Never started
+            }
+        }
+        cancelled.push_back(id);
+    }
+    notify_io();
+}
+
+void HttpExecutor::keep_warm(const std::string& url, std::vector<std::string> headers,
+                             std::chrono::seconds interval) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        warm_url = url;
+        warm_headers = headers;
+        warm_interval = interval;
+        if (!url.empty()) {
+            submitted.push_back({next_id++, url, std::move(headers), [](Response&) {}});
+        }
+    }
+    notify_io();
+}
+
+void HttpExecutor::post(std::function<void()> fn) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        completions.push_back(std::move(fn));
+    }
+    if (wake_pipe[1] >= 0) {
+        char byte = 1;
+        (void)::write(wake_pipe[1], &byte, 1);  // A full pipe already wakes the reader
+    }
+}
+
+void HttpExecutor::run_completions() {
+    if (wake_pipe[0] >= 0) {
+        char buf[64];
+        while (::read(wake_pipe[0], buf, sizeof(buf)) > 0) {
+        }
+    }
+
+    std::deque<std::function<void()>> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ready.swap(completions);
+    }
+    for (auto& fn : ready) {
+        try {
+            fn();
+        } catch (...) {
+            // A failed result handler must not take the UI loop down
+        }
+    }
+}
+
+size_t HttpExecutor::header_callback(char* buffer, size_t size, size_t nitems, void* userdata) {
+    size_t length = size * nitems;
+    auto* response = static_cast<Response*>(userdata);
+    std::string line(buffer, length);
+    
+    auto value_of = [&line](size_t name_length) {
+        size_t start = line.find_first_not_of(" \t", name_length);
+        size_t end = line.find_last_not_of(" \t\r\n");
+        return (start == std::string::npos || end < start) ? std::string() : line.substr(start, end - start + 1);
+    };
+    if (line.size() > 5 && strncasecmp(line.c_str(), "ETag:", 5) == 0) {
+        response->etag = value_of(5);
+    } else if (line.size() > 14 && strncasecmp(line.c_str(), "Last-Modified:", 14) == 0) {
+        response->last_modified = value_of(14);
+    }
+    return length;
+}
+
+void HttpExecutor::notify_io() {
+    if (multi) curl_multi_wakeup(multi);
+}
+
+void HttpExecutor::io_loop() {
+    if (!multi) return;
+    std::unordered_map<uint64_t, std::unique_ptr<Transfer>> transfers;
+    auto last_activity = std::chrono::steady_clock::now();
+
+    while (true) {
+        std::deque<Pending> starting;
+        std::vector<uint64_t> stopping;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!running) break;
+            starting.swap(submitted);
+            stopping.swap(cancelled);
+            
+            // Idle for a while: touch the server so its connection stays open
+            auto now = std::chrono::steady_clock::now();
+            if (!transfers.empty() || !starting.empty()) {
+                last_activity = now;
+            } else if (!warm_url.empty() && warm_interval.count() > 0 && now - last_activity >= warm_interval) {
+                starting.push_back({next_id++, warm_url, warm_headers, [](Response&) {}});
+                last_activity = now;
+            }
+        }
+
+        for (uint64_t id : stopping) {
+            auto it = transfers.find(id);
+            if (it == transfers.end()) continue;
+            curl_multi_remove_handle(multi, it->second->easy);
+            transfers.erase(it);
+        }
+
+        for (auto& pending : starting) {
+            auto transfer = std::make_unique<Transfer>();
+            transfer->id = pending.id;
+            transfer->url = std::move(pending.url);
+            transfer->on_done = std::move(pending.on_done);
+            transfer->easy = curl_easy_init();
+            if (!transfer->easy) {
+                Response failed;
+                transfer->on_done(failed);
+                continue;
+            }
+            for (const auto& header : pending.headers) {
+                transfer->headers = curl_slist_append(transfer->headers, header.c_str());
+            }
+
+            // Same transfer settings as PlexClient::make_request
+            CURL* easy = transfer->easy;
+            HttpPool::instance().configure(easy);
+            curl_easy_setopt(easy, CURLOPT_URL, transfer->url.c_str());
+            curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, Transfer::write_callback);
+            curl_easy_setopt(easy, CURLOPT_WRITEDATA, &transfer->response.body);
+            curl_easy_setopt(easy, CURLOPT_HEADERFUNCTION, header_callback);
+            curl_easy_setopt(easy, CURLOPT_HEADERDATA, &transfer->response);
+            curl_easy_setopt(easy, CURLOPT_TIMEOUT, 5L);
+            curl_easy_setopt(easy, CURLOPT_CONNECTTIMEOUT, 3L);
+            curl_easy_setopt(easy, CURLOPT_SSL_VERIFYPEER, 0L);  // Allow self-signed certs
+            curl_easy_setopt(easy, CURLOPT_SSL_VERIFYHOST, 0L);
+            curl_easy_setopt(easy, CURLOPT_FOLLOWLOCATION, 1L);
+            curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+            curl_easy_setopt(easy, CURLOPT_HTTPHEADER, transfer->headers);
+            curl_easy_setopt(easy, CURLOPT_PRIVATE, transfer.get());
+
+            curl_multi_add_handle(multi, easy);
+            transfers[transfer->id] = std::move(transfer);
+        }
+
+        int still_running = 0;
+        curl_multi_perform(multi, &still_running);
+
+        int queued = 0;
+        while (CURLMsg* msg = curl_multi_info_read(multi, &queued)) {
+            if (msg->msg != CURLMSG_DONE) continue;
+            Transfer* transfer = nullptr;
+            curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, &transfer);
+            if (!transfer) continue;
+
+            Response& response = transfer->response;
+            curl_easy_getinfo(transfer->easy, CURLINFO_RESPONSE_CODE, &response.status);
+            response.ok = msg->data.result == CURLE_OK && response.status >= 200 && response.status < 300;
+            curl_multi_remove_handle(multi, transfer->easy);
+
+            try {
+                transfer->on_done(response);
+            } catch (...) {
+                // Parsing failed - the request simply produces nothing
+            }
+            transfers.erase(transfer->id);
+        }
+
+        // Sleep until a socket is ready, a transfer times out or notify_io()
+        curl_multi_poll(multi, nullptr, 0, 1000, nullptr);
+    }
+
+    for (auto& entry : transfers) {
+        curl_multi_remove_handle(multi, entry.second->easy);
+    }
+}
+
+} // namespace PlexTUI
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <curl/curl.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+
+namespace PlexTUI {
+
+/**
+ * Asynchronous HTTP executor
+ * One curl multi handle driven by a dedicated I/O thread, so any number of
+ * requests are in flight without blocking the caller (multiplexed over one
+ * connection where the server speaks HTTP/2). Completion handlers run
+ * on the I/O thread (keep them to parsing); they hand results to the UI by
+ * post()ing closures, which the UI loop runs from run_completions(). A pipe
+ * wakes the UI loop's poll() as soon as something is posted.
+ */
+class HttpExecutor {
+public:
+    struct Response {
+        bool ok = false;      // Transfer completed with a 2xx status
+        long status = 0;      // HTTP status (0 = no response)
+        std::string body;
+        std::string etag;           // Validators for conditional requests
+        std::string last_modified;
+    };
+    using Handler = std::function<void(Response&)>;
+
+    HttpExecutor();
+    ~HttpExecutor();
+    HttpExecutor(const HttpExecutor&) = delete;
+    HttpExecutor& operator=(const HttpExecutor&) = delete;
+
+    // Start a GET; returns an id for cancel()
+    uint64_t submit(const std::string& url, std::vector<std::string> headers, Handler on_done);
+
+    // Abort a request (its handler never runs)
+    void cancel(uint64_t id);
+
+    // Keep a connection to url's server open: fetch it now, then again whenever
+    // the executor has been idle for interval, so the first request after a
+    // pause finds a live connection
+    void keep_warm(const std::string& url, std::vector<std::string> headers, std::chrono::seconds interval);
+    
+    // Queue a closure for the UI thread
+    void post(std::function<void()> fn);
+
+    // UI thread: run everything posted so far
+    void run_completions();
+
+    // Readable while completions are waiting (for the UI loop's poll)
+    int wake_fd() const { return wake_pipe[0]; }
+    
+    // CURLOPT_HEADERFUNCTION collecting ETag / Last-Modified into a Response
+    static size_t header_callback(char* buffer, size_t size, size_t nitems, void* userdata);
+
+private:
+    struct Pending {
+        uint64_t id;
+        std::string url;
+        std::vector<std::string> headers;
+        Handler on_done;
+    };
+    struct Transfer;
+
+    void io_loop();
+    void notify_io();
+
+    std::thread io_thread;
+    std::mutex mutex;
+    bool running = true;
+    uint64_t next_id = 1;
+    std::deque<Pending> submitted;            // Waiting to be added to the multi handle
+    std::vector<uint64_t> cancelled;          // Waiting to be removed from it
+    std::deque<std::function<void()>> completions;  // For the UI thread
+    std::string warm_url;                     // keep_warm() target (empty = off)
+    std::vector<std::string> warm_headers;
+    std::chrono::seconds warm_interval{0};
+    CURLM* multi = nullptr;                   // Touched only by the I/O thread after construction
+    int wake_pipe[2] = {-1, -1};
+};
+
+} // namespace PlexTUI
@@ -0,0 +1,135 @@
+#include "http_pool.h"
+
+namespace PlexTUI {
+
+namespace {
+
+size_t append_body(char* ptr, size_t size, size_t nmemb, void* userdata) {
+    static_cast<std::string*>(userdata)->append(ptr, size * nmemb);
+    return size * nmemb;
+}
+
+int check_abort(void* clientp, curl_off_t, curl_off_t, curl_off_t, curl_off_t) {
+    const auto* abort = static_cast<const std::function<bool()>*>(clientp);
+    return (*abort)() ? 1 : 0;  // Non-zero aborts the transfer
+}
+
+} // namespace
+
+HttpPool& HttpPool::instance() {
+    static HttpPool pool;
+    return pool;
+}
+
+HttpPool::HttpPool() {
+    // Holds a global init reference until the pool is destroyed at exit, after
+    // every handle it parked has been cleaned up
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+    share = curl_share_init();
+    if (share) {
+        curl_share_setopt(share, CURLSHOPT_LOCKFUNC, lock_callback);
+        curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, unlock_callback);
+        curl_share_setopt(share, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+}
+
+HttpPool::~HttpPool() {
+    for (CURL* easy : idle) {
+        curl_easy_cleanup(easy);
+    }
+    idle.clear();
+    if (share) curl_share_cleanup(share);
+    curl_global_cleanup();
+}
+
+void HttpPool::lock_callback(CURL*, curl_lock_data data, curl_lock_access, void* userptr) {
+    static_cast<HttpPool*>(userptr)->share_locks[data].lock();
+}
+
+void HttpPool::unlock_callback(CURL*, curl_lock_data data, void* userptr) {
+    static_cast<HttpPool*>(userptr)->share_locks[data].unlock();
+}
+
+void HttpPool::configure(CURL* easy) {
+    if (!easy) return;
+    if (share) curl_easy_setopt(easy, CURLOPT_SHARE, share);
+    curl_easy_setopt(easy, CURLOPT_DNS_CACHE_TIMEOUT, 600L);  // Server addresses rarely move
+    curl_easy_setopt(easy, CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_2TLS));
+    curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);  // Prefer multiplexing over a second connection
+
+    // Keep idle connections usable: TCP keepalive stops NAT/firewalls dropping
+    // them, and curl keeps them for up to 10 minutes instead of ~2
+    curl_easy_setopt(easy, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(easy, CURLOPT_TCP_KEEPIDLE, 30L);
+    curl_easy_setopt(easy, CURLOPT_TCP_KEEPINTVL, 15L);
+    curl_easy_setopt(easy, CURLOPT_MAXAGE_CONN, 600L);
+    curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);  // Safe from worker threads
+}
+
+CURL* HttpPool::acquire() {
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        if (!idle.empty()) {
+            CURL* easy = idle.back();  // Most recently used: its connections are warmest
+            idle.pop_back();
+            return easy;
+        }
+    }
+    return curl_easy_init();
+}
+
+void HttpPool::release(CURL* easy) {
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        if (idle.size() < MAX_IDLE) {
+            idle.push_back(easy);
+            return;
+        }
+    }
+    curl_easy_cleanup(easy);
+}
+
+bool HttpPool::get(const std::string& url, const std::vector<std::string>& headers, long timeout_s,
+                   std::string& body, long* status, const std::function<bool()>& abort, bool verify_tls) {
+    CURL* easy = acquire();
+    if (!easy) return false;
+
+    // reset() clears options but keeps the handle's open connections
+    curl_easy_reset(easy);
+    configure(easy);
+
+    curl_slist* header_list = nullptr;
+    for (const auto& header : headers) {
+        header_list = curl_slist_append(header_list, header.c_str());
+    }
+    curl_easy_setopt(easy, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(easy, CURLOPT_HTTPHEADER, header_list);
+    curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, append_body);
+    curl_easy_setopt(easy, CURLOPT_WRITEDATA, &body);
+    curl_easy_setopt(easy, CURLOPT_TIMEOUT, timeout_s);
+    curl_easy_setopt(easy, CURLOPT_CONNECTTIMEOUT, 3L);
+    curl_easy_setopt(easy, CURLOPT_FOLLOWLOCATION, 1L);
+    if (!verify_tls) {
+        curl_easy_setopt(easy, CURLOPT_SSL_VERIFYPEER, 0L);  // Allow self-signed certs
+        curl_easy_setopt(easy, CURLOPT_SSL_VERIFYHOST, 0L);
+    }
+    curl_easy_setopt(easy, CURLOPT_ACCEPT_ENCODING, "");  // Whatever compression curl supports
+    if (abort) {
+        curl_easy_setopt(easy, CURLOPT_XFERINFOFUNCTION, check_abort);
+        curl_easy_setopt(easy, CURLOPT_XFERINFODATA, &abort);
+        curl_easy_setopt(easy, CURLOPT_NOPROGRESS, 0L);
+    }
+
+    CURLcode res = curl_easy_perform(easy);
+    if (status) {
+        *status = 0;
+        curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, status);
+    }
+    curl_slist_free_all(header_list);
+    release(easy);
+    return res == CURLE_OK;
+}
+
+} // namespace PlexTUI
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <curl/curl.h>
+#include <string>
+#include <vector>
+#include <functional>
+#include <mutex>
+
+namespace PlexTUI {
+
+/**
+ * Process-wide HTTP connection pool
+ * A curl share handle holds the DNS cache and TLS sessions for every easy handle
+ * in the program, and finished handles are parked (connections still open) for
+ * the next blocking request on any thread. Together that takes DNS, TCP and TLS
+ * setup off all but the first request to a host. HTTP/2 is negotiated where the
+ * server offers it, so transfers in the async executor multiplex on one connection.
+ *
+ * libcurl does not support sharing one connection cache between concurrent
+ * threads, so connections stay with their handle (or multi handle); only the
+ * thread-safe caches live in the share.
+ */
+class HttpPool {
+public:
+    static HttpPool& instance();
+
+    // Attach an easy handle to the shared caches and apply the keep-alive and
+    // HTTP/2 settings (call again after curl_easy_reset)
+    void configure(CURL* easy);
+
+    // Blocking GET on a pooled handle. Returns false only if the transfer itself
+    // failed; the body of an HTTP error response is still returned. abort, if set,
+    // is polled while waiting and cancels the transfer when it returns true.
+    // Certificates are verified unless verify_tls is false, which is only for the
+    // Plex server (often self-signed, like make_request and HttpExecutor allow).
+    bool get(const std::string& url, const std::vector<std::string>& headers, long timeout_s,
+             std::string& body, long* status = nullptr, const std::function<bool()>& abort = nullptr,
+             bool verify_tls = true);
+
+private:
+    HttpPool();
+    ~HttpPool();
+    HttpPool(const HttpPool&) = delete;
+    HttpPool& operator=(const HttpPool&) = delete;
+
+    CURL* acquire();
+    void release(CURL* easy);
+
+    static void lock_callback(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr);
+    static void unlock_callback(CURL* handle, curl_lock_data data, void* userptr);
+
+    static constexpr size_t MAX_IDLE = 8;  // Parked handles (each may hold open connections; bulk loads use several)
+
+    CURLSH* share = nullptr;
+    std::mutex share_locks[CURL_LOCK_DATA_LAST];
+    std::mutex pool_mutex;
+    std::vector<CURL*> idle;
+};
+
+} // namespace PlexTUI
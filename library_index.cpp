@@ -0,0 +1,408 @@
+#include "library_index.h"
+#include "fnv1a.h"
+#include <algorithm>
+#include <unordered_map>
+#include <numeric>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace PlexTUI {
+
+// On-disk layout (host byte order; the header rejects anything else):
+// Header | artist, album, track records | id tables | album title order | strings
+struct LibraryIndex::Str {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct LibraryIndex::Record {
+    Str id, parent_id, title, sort_title, artist, album, thumb, art, part_key, codec, genre;
+    uint32_t first_child;  // Artist: first album, album: first track
+    uint32_t child_count;
+    int32_t year;
+    uint32_t duration_ms;
+    int32_t bitrate;
+    uint16_t disc;
+    uint16_t number;
+    int64_t updated_at;
+};
+
+struct LibraryIndex::IdEntry {
+    uint64_t hash;  // fnv1a_64 of the id
+    uint32_t index;
+    uint32_t reserved;
+};
+
+namespace {
+
+struct Table {
+    uint64_t offset;
+    uint64_t count;
+};
+
+constexpr char MAGIC[8] = {'P', 'L', 'X', 'L', 'I', 'B', '\0', '\0'};
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+// Case-insensitive (ASCII) ordering key
+std::string sort_key(const LibraryIndex::Item& item) {
+    std::string key = item.sort_title.empty() ? item.title : item.sort_title;
+    for (char& c : key) {
+        if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+    }
+    return key;
+}
+
+size_t align8(size_t n) {
+    return (n + 7) & ~static_cast<size_t>(7);
+}
+
+} // namespace
+
+struct LibraryIndex::Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t record_size;
+    int32_t section_id;
+    int64_t synced_at;
+    Table records[3];  // By Kind
+    Table ids[3];
+    Table album_title_order;
+    Table strings;     // count = bytes
+    uint64_t file_size;
+};
+
+LibraryIndex::~LibraryIndex() {
+    if (data) {
+        munmap(const_cast<uint8_t*>(data), size);
+    }
+}
+
+std::string LibraryIndex::default_directory() {
+    const char* xdg = getenv("XDG_CACHE_HOME");
+    if (xdg && *xdg) {
+        return std::string(xdg) + "/plex-tui/library";
+    }
+    const char* home = getenv("HOME");
+    if (home) {
+        return std::string(home) + "/.cache/plex-tui/library";
+    }
+    return "";
+}
+
+std::shared_ptr<const LibraryIndex> LibraryIndex::open(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return nullptr;
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Header))) {
+        close(fd);
+        return nullptr;
+    }
+    size_t length = static_cast<size_t>(st.st_size);
+    void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping keeps the file (even once replaced) alive
+    if (mapped == MAP_FAILED) return nullptr;
+
+    std::shared_ptr<LibraryIndex> index(new LibraryIndex());
+    index->data = static_cast<const uint8_t*>(mapped);
+    index->size = length;
+    const Header* h = reinterpret_cast<const Header*>(index->data);
+
+    if (memcmp(h->magic, MAGIC, sizeof(MAGIC)) != 0 || h->version != VERSION ||
+        h->byte_order != BYTE_ORDER_MARK || h->record_size != sizeof(Record) || h->file_size != length) {
+        return nullptr;
+    }
+    // Every table must lie inside the file (records aligned for direct access)
+    auto fits = [length](const Table& t, size_t element) {
+        return t.offset % 8 == 0 && t.offset <= length && t.count <= (length - t.offset) / element;
+    };
+    for (int k = 0; k < 3; ++k) {
+        if (!fits(h->records[k], sizeof(Record)) || !fits(h->ids[k], sizeof(IdEntry))) return nullptr;
+    }
+    if (!fits(h->album_title_order, sizeof(uint32_t)) || !fits(h->strings, 1) ||
+        h->album_title_order.count != h->records[static_cast<int>(Kind::Album)].count) {
+        return nullptr;
+    }
+    index->header = h;
+    return index;
+}
+
+int LibraryIndex::section_id() const {
+    return header->section_id;
+}
+
+int64_t LibraryIndex::synced_at() const {
+    return header->synced_at;
+}
+
+size_t LibraryIndex::count(Kind kind) const {
+    return static_cast<size_t>(header->records[static_cast<int>(kind)].count);
+}
+
+const LibraryIndex::Record* LibraryIndex::records(Kind kind) const {
+    return reinterpret_cast<const Record*>(data + header->records[static_cast<int>(kind)].offset);
+}
+
+std::string_view LibraryIndex::str(const Str& s) const {
+    // Checked on every read rather than once at open: a snapshot is only trusted this far
+    if (static_cast<uint64_t>(s.offset) + s.length > header->strings.count) return {};
+    return std::string_view(reinterpret_cast<const char*>(data + header->strings.offset) + s.offset, s.length);
+}
+
+LibraryIndex::Item LibraryIndex::item(Kind kind, size_t index) const {
+    Item item;
+    if (index >= count(kind)) return item;
+    const Record& r = records(kind)[index];
+    item.id = str(r.id);
+    item.parent_id = str(r.parent_id);
+    item.title = str(r.title);
+    item.sort_title = str(r.sort_title);
+    item.artist = str(r.artist);
+    item.album = str(r.album);
+    item.thumb = str(r.thumb);
+    item.art = str(r.art);
+    item.part_key = str(r.part_key);
+    item.codec = str(r.codec);
+    item.genre = str(r.genre);
+    item.year = r.year;
+    item.disc = r.disc;
+    item.number = r.number;
+    item.duration_ms = r.duration_ms;
+    item.bitrate = r.bitrate;
+    item.updated_at = r.updated_at;
+    return item;
+}
+
+std::vector<LibraryIndex::Item> LibraryIndex::items(Kind kind) const {
+    std::vector<Item> result;
+    result.reserve(count(kind));
+    for (size_t i = 0; i < count(kind); ++i) {
+        result.push_back(item(kind, i));
+    }
+    return result;
+}
+
+size_t LibraryIndex::find(Kind kind, std::string_view id) const {
+    const Table& table = header->ids[static_cast<int>(kind)];
+    const IdEntry* begin = reinterpret_cast<const IdEntry*>(data + table.offset);
+    const IdEntry* end = begin + table.count;
+    uint64_t hash = fnv1a_64(id);
+    const IdEntry* it = std::lower_bound(begin, end, hash,
+                                         [](const IdEntry& e, uint64_t h) { return e.hash < h; });
+    for (; it != end && it->hash == hash; ++it) {
+        if (it->index < count(kind) && str(records(kind)[it->index].id) == id) {
+            return it->index;
+        }
+    }
+    return npos;
+}
+
+LibraryIndex::Range LibraryIndex::children(Kind kind, size_t index) const {
+    if (kind == Kind::Track || index >= count(kind)) return {};
+    const Record& r = records(kind)[index];
+    size_t available = count(kind == Kind::Artist ? Kind::Album : Kind::Track);
+    size_t first = std::min<size_t>(r.first_child, available);
+    return {first, std::min<size_t>(r.child_count, available - first)};
+}
+
+size_t LibraryIndex::album_by_title(size_t position) const {
+    if (position >= count(Kind::Album)) return npos;
+    const uint32_t* order = reinterpret_cast<const uint32_t*>(data + header->album_title_order.offset);
+    return order[position] < count(Kind::Album) ? order[position] : npos;
+}
+
+bool LibraryIndex::write(const std::string& path, int section_id, int64_t synced_at,
+                         const std::vector<Item>& artists, const std::vector<Item>& albums,
+                         const std::vector<Item>& tracks) {
+    // Browse order. Children follow their parent's order; orphans (parent not
+    // in the snapshot) go last
+    auto order_by = [](const std::vector<Item>& items, auto less) {
+        std::vector<uint32_t> order(items.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), less);
+        return order;
+    };
+    auto positions = [](const std::vector<Item>& items, const std::vector<uint32_t>& order) {
+        std::unordered_map<std::string, uint32_t> position;
+        position.reserve(order.size());
+        for (uint32_t i = 0; i < order.size(); ++i) {
+            position.emplace(items[order[i]].id, i);
+        }
+        return position;
+    };
+    auto parent_position = [](const std::unordered_map<std::string, uint32_t>& parents, const Item& item) {
+        auto it = parents.find(item.parent_id);
+        return it != parents.end() ? it->second : UINT32_MAX;
+    };
+
+    std::vector<std::string> artist_keys, album_keys, track_keys;
+    for (const auto& a : artists) artist_keys.push_back(sort_key(a));
+    for (const auto& a : albums) album_keys.push_back(sort_key(a));
+    for (const auto& t : tracks) track_keys.push_back(sort_key(t));
+
+    auto artist_order = order_by(artists, [&](uint32_t a, uint32_t b) { return artist_keys[a] < artist_keys[b]; });
+    auto artist_pos = positions(artists, artist_order);
+
+    std::vector<uint32_t> album_parent(albums.size());
+    for (size_t i = 0; i < albums.size(); ++i) album_parent[i] = parent_position(artist_pos, albums[i]);
+    auto album_order = order_by(albums, [&](uint32_t a, uint32_t b) {
+        if (album_parent[a] != album_parent[b]) return album_parent[a] < album_parent[b];
+        if (albums[a].year != albums[b].year) return albums[a].year < albums[b].year;
+        return album_keys[a] < album_keys[b];
+    });
+    auto album_pos = positions(albums, album_order);
+
+    std::vector<uint32_t> track_parent(tracks.size());
+    for (size_t i = 0; i < tracks.size(); ++i) track_parent[i] = parent_position(album_pos, tracks[i]);
+    auto track_order = order_by(tracks, [&](uint32_t a, uint32_t b) {
+        if (track_parent[a] != track_parent[b]) return track_parent[a] < track_parent[b];
+        if (tracks[a].disc != tracks[b].disc) return tracks[a].disc < tracks[b].disc;
+        if (tracks[a].number != tracks[b].number) return tracks[a].number < tracks[b].number;
+        return track_keys[a] < track_keys[b];
+    });
+
+    // Album list by title, as positions in album browse order
+    std::vector<uint32_t> album_title_order(albums.size());
+    std::iota(album_title_order.begin(), album_title_order.end(), 0);
+    std::stable_sort(album_title_order.begin(), album_title_order.end(), [&](uint32_t a, uint32_t b) {
+        return album_keys[album_order[a]] < album_keys[album_order[b]];
+    });
+
+    // Strings are interned: artist and album names repeat on every track
+    std::string strings;
+    std::unordered_map<std::string, Str> interned;
+    auto intern = [&](const std::string& s) -> Str {
+        if (s.empty()) return {0, 0};
+        auto it = interned.find(s);
+        if (it != interned.end()) return it->second;
+        Str ref{static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(s.size())};
+        strings += s;
+        interned.emplace(s, ref);
+        return ref;
+    };
+    auto make_record = [&](const Item& item) {
+        Record r{};
+        r.id = intern(item.id);
+        r.parent_id = intern(item.parent_id);
+        r.title = intern(item.title);
+        r.sort_title = intern(item.sort_title);
+        r.artist = intern(item.artist);
+        r.album = intern(item.album);
+        r.thumb = intern(item.thumb);
+        r.art = intern(item.art);
+        r.part_key = intern(item.part_key);
+        r.codec = intern(item.codec);
+        r.genre = intern(item.genre);
+        r.year = item.year;
+        r.duration_ms = item.duration_ms;
+        r.bitrate = item.bitrate;
+        r.disc = static_cast<uint16_t>(std::clamp(item.disc, 0, 0xFFFF));
+        r.number = static_cast<uint16_t>(std::clamp(item.number, 0, 0xFFFF));
+        r.updated_at = item.updated_at;
+        return r;
+    };
+
+    std::vector<Record> records[3];
+    const std::vector<Item>* sources[3] = {&artists, &albums, &tracks};
+    const std::vector<uint32_t>* orders[3] = {&artist_order, &album_order, &track_order};
+    for (int k = 0; k < 3; ++k) {
+        records[k].reserve(orders[k]->size());
+        for (uint32_t i : *orders[k]) {
+            records[k].push_back(make_record((*sources[k])[i]));
+        }
+    }
+    if (strings.size() > UINT32_MAX) return false;
+
+    // Child ranges: children are contiguous because they are sorted by parent
+    const std::vector<uint32_t>* child_parents[2] = {&album_parent, &track_parent};
+    for (int k = 0; k < 2; ++k) {
+        const auto& child_order = *orders[k + 1];
+        const auto& parent_of = *child_parents[k];
+        for (uint32_t pos = 0; pos < child_order.size(); ++pos) {
+            uint32_t parent = parent_of[child_order[pos]];
+            if (parent == UINT32_MAX) break;  // Orphans are last
+            Record& r = records[k][parent];
+            if (r.child_count == 0) r.first_child = pos;
+            r.child_count++;
+        }
+    }
+
+    std::vector<IdEntry> ids[3];
+    for (int k = 0; k < 3; ++k) {
+        const auto& order = *orders[k];
+        ids[k].reserve(order.size());
+        for (uint32_t pos = 0; pos < order.size(); ++pos) {
+            ids[k].push_back({fnv1a_64((*sources[k])[order[pos]].id), pos, 0});
+        }
+        std::sort(ids[k].begin(), ids[k].end(),
+                  [](const IdEntry& a, const IdEntry& b) { return a.hash < b.hash; });
+    }
+
+    // Lay out the file
+    Header header{};
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.byte_order = BYTE_ORDER_MARK;
+    header.record_size = sizeof(Record);
+    header.section_id = section_id;
+    header.synced_at = synced_at;
+    size_t offset = align8(sizeof(Header));
+    for (int k = 0; k < 3; ++k) {
+        header.records[k] = {offset, records[k].size()};
+        offset = align8(offset + records[k].size() * sizeof(Record));
+    }
+    for (int k = 0; k < 3; ++k) {
+        header.ids[k] = {offset, ids[k].size()};
+        offset = align8(offset + ids[k].size() * sizeof(IdEntry));
+    }
+    header.album_title_order = {offset, album_title_order.size()};
+    offset = align8(offset + album_title_order.size() * sizeof(uint32_t));
+    header.strings = {offset, strings.size()};
+    header.file_size = offset + strings.size();
+
+    std::vector<uint8_t> file(header.file_size, 0);
+    auto put = [&file](uint64_t at, const void* bytes, size_t length) {
+        if (length) memcpy(file.data() + at, bytes, length);
+    };
+    put(0, &header, sizeof(header));
+    for (int k = 0; k < 3; ++k) {
+        put(header.records[k].offset, records[k].data(), records[k].size() * sizeof(Record));
+        put(header.ids[k].offset, ids[k].data(), ids[k].size() * sizeof(IdEntry));
+    }
+    put(header.album_title_order.offset, album_title_order.data(), album_title_order.size() * sizeof(uint32_t));
+    put(header.strings.offset, strings.data(), strings.size());
+
+    // Write beside the final name and rename over it: readers (including other
+    // instances) never see a partial file
+    std::error_code ec;
+    fs::create_directories(fs::path(path).parent_path(), ec);
+    std::string temp = path + ".tmp" + std::to_string(getpid());
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+        if (!out) {
+            out.close();
+            fs::remove(temp, ec);
+            return false;
+        }
+    }
+    fs::rename(temp, path, ec);
+    if (ec) {
+        fs::remove(temp, ec);
+        return false;
+    }
+    return true;
+}
+
+} // namespace PlexTUI
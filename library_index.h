@@ -0,0 +1,103 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+namespace PlexTUI {
+
+/**
+ * Local snapshot of one music section
+ * Artists, albums and tracks live in a single memory-mapped file: fixed-width
+ * records that point into a shared (deduplicated) string table, stored in
+ * browse order - artists by sort title, each artist's albums together by year,
+ * each album's tracks by disc and track number - with sorted id tables for
+ * lookups. Opening a snapshot maps it and checks the header, so a cold start
+ * has the whole library browsable in milliseconds without touching the network.
+ * Snapshots are immutable; LibrarySync writes a new file and swaps it in.
+ */
+class LibraryIndex {
+public:
+    enum class Kind { Artist, Album, Track };
+
+    // One library item, as fetched from the server or read back from a snapshot
+    struct Item {
+        std::string id;          // ratingKey
+        std::string parent_id;   // Album: its artist, track: its album
+        std::string title;
+        std::string sort_title;  // titleSort (empty: sorts by title)
+        std::string artist;      // Album: parentTitle, track: grandparentTitle
+        std::string album;       // Track: parentTitle
+        std::string thumb;
+        std::string art;
+        std::string part_key;    // Track: first media part
+        std::string codec;
+        std::string genre;
+        int year = 0;
+        int disc = 0;            // parentIndex
+        int number = 0;          // index
+        uint32_t duration_ms = 0;
+        int bitrate = 0;
+        int64_t updated_at = 0;  // Server clock: latest of updatedAt / addedAt
+    };
+
+    struct Range {
+        size_t first = 0;
+        size_t count = 0;
+    };
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    ~LibraryIndex();
+    LibraryIndex(const LibraryIndex&) = delete;
+    LibraryIndex& operator=(const LibraryIndex&) = delete;
+
+    // Map a snapshot (nullptr if missing, from another version or damaged)
+    static std::shared_ptr<const LibraryIndex> open(const std::string& path);
+
+    // Write a snapshot of these items, ordered for browsing, atomically
+    // (temp file + rename: readers keep their mapping of the old one)
+    static bool write(const std::string& path, int section_id, int64_t synced_at,
+                      const std::vector<Item>& artists, const std::vector<Item>& albums,
+                      const std::vector<Item>& tracks);
+
+    int section_id() const;
+    int64_t synced_at() const;  // Newest updated_at in the snapshot (delta sync starts here)
+    size_t count(Kind kind) const;
+
+    // Item at a browse position (strings copied out of the mapping)
+    Item item(Kind kind, size_t index) const;
+    std::vector<Item> items(Kind kind) const;
+
+    // Browse position of an id, or npos
+    size_t find(Kind kind, std::string_view id) const;
+
+    // Artist -> its albums, album -> its tracks (positions in the child table)
+    Range children(Kind kind, size_t index) const;
+
+    // Albums in title order (the library-wide album list): position -> album index
+    size_t album_by_title(size_t position) const;
+
+    // $XDG_CACHE_HOME/plex-tui/library, else ~/.cache/plex-tui/library
+    static std::string default_directory();
+
+private:
+    struct Str;
+    struct Record;
+    struct IdEntry;
+    struct Header;
+
+    LibraryIndex() = default;
+
+    const Record* records(Kind kind) const;
+    std::string_view str(const Str& s) const;
+
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    const Header* header = nullptr;
+};
+
+} // namespace PlexTUI
@@ -0,0 +1,253 @@
+#include "library_sync.h"
+#include "plex_json.h"
+#include "page_fetcher.h"
+#include <unordered_map>
+#include <algorithm>
+
+namespace PlexTUI {
+
+namespace {
+
+using Kind = LibraryIndex::Kind;
+
+constexpr Kind KINDS[3] = {Kind::Artist, Kind::Album, Kind::Track};
+constexpr int PLEX_TYPES[3] = {8, 9, 10};  // Plex metadata types for artist, album, track
+
+constexpr std::chrono::minutes RETRY_INTERVAL{1};
+
+LibraryIndex::Item parse_item(int type, const PlexJSON::Value& value) {
+    LibraryIndex::Item item;
+    int64_t added_at = 0;
+    value.for_each_member([&](std::string_view key, const PlexJSON::Value& field) {
+        if (key == "ratingKey") item.id = field.str();
+        else if (key == "title") item.title = field.str();
+        else if (key == "titleSort") item.sort_title = field.str();
+        else if (key == "parentRatingKey") item.parent_id = field.str();
+        else if (key == "parentTitle") (type == 9 ? item.artist : item.album) = field.str();
+        else if (key == "grandparentTitle") item.artist = field.str();
+        else if (key == "thumb") item.thumb = field.str();
+        else if (key == "art") item.art = field.str();
+        else if (key == "genre") item.genre = field.str();
+        else if (key == "year") item.year = static_cast<int>(field.integer());
+        else if (key == "parentYear" && item.year == 0) item.year = static_cast<int>(field.integer());
+        else if (key == "parentIndex") item.disc = static_cast<int>(field.integer());
+        else if (key == "index") item.number = static_cast<int>(field.integer());
+        else if (key == "duration") item.duration_ms = static_cast<uint32_t>(field.integer());
+        else if (key == "updatedAt") item.updated_at = field.integer();
+        else if (key == "addedAt") added_at = field.integer();
+        else if (key == "Media") {
+            PlexJSON::Value media = field[0];
+            item.bitrate = static_cast<int>(media["bitrate"].integer());
+            item.codec = media["audioCodec"].str();
+            item.part_key = media["Part"][0]["key"].str();
+        }
+        return true;
+    });
+    item.updated_at = std::max(item.updated_at, added_at);
+    return item;
+}
+
+std::string section_endpoint(int section, int type) {
+    return "/library/sections/" + std::to_string(section) + "/all?type=" + std::to_string(type);
+}
+
+} // namespace
+
+LibrarySync::LibrarySync(std::string snapshot_path, int section_id, Fetch fetch, int parallel)
+    : path(std::move(snapshot_path)), section(section_id), fetch(std::move(fetch)), parallel(parallel) {
+}
+
+LibrarySync::~LibrarySync() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    abort_requested = true;  // Cut short a page that is downloading
+    wake.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void LibrarySync::start() {
+    if (worker.joinable()) return;
+    auto snapshot = LibraryIndex::open(path);
+    if (snapshot && snapshot->section_id() == section) {
+        publish(std::move(snapshot));
+    }
+    worker = std::thread(&LibrarySync::run, this);
+}
+
+std::shared_ptr<const LibraryIndex> LibrarySync::index() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return current;
+}
+
+std::shared_ptr<const SearchIndex> LibrarySync::search_index() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return search;
+}
+
+LibrarySync::Status LibrarySync::status() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return state;
+}
+
+void LibrarySync::publish(std::shared_ptr<const LibraryIndex> next) {
+    std::lock_guard<std::mutex> lock(mutex);
+    state.artists = next->count(Kind::Artist);
+    state.albums = next->count(Kind::Album);
+    state.tracks = next->count(Kind::Track);
+    current = std::move(next);
+    index_version++;
+}
+
+void LibrarySync::build_search(std::shared_ptr<const LibraryIndex> snapshot) {
+    if (!snapshot) return;
+    auto built = SearchIndex::build(std::move(snapshot));
+    std::lock_guard<std::mutex> lock(mutex);
+    search = std::move(built);
+}
+
+void LibrarySync::run() {
+    build_search(index());  // The snapshot loaded by start(), searchable before any request
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            state.syncing = true;
+        }
+        bool ok = sync_once();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        state.syncing = false;
+        if (ok) {
+            state.synced = true;
+            state.error.clear();
+        }
+        wake.wait_for(lock, ok ? SYNC_INTERVAL : RETRY_INTERVAL,
+                      [this] { return stopping; });
+        if (stopping) return;
+    }
+}
+
+bool LibrarySync::fetch_total(int type, size_t& total) {
+    // An empty page still reports the section's size
+    std::string body;
+    auto abort = [this] { return abort_requested.load(); };
+    if (!fetch(section_endpoint(section, type) + "&X-Plex-Container-Start=0&X-Plex-Container-Size=0", body, abort)) {
+        return false;
+    }
+    PlexJSON::Value size = PlexJSON::parse(body)["MediaContainer"]["totalSize"];
+    total = size.exists() ? static_cast<size_t>(size.integer()) : LibraryIndex::npos;
+    return true;
+}
+
+bool LibrarySync::fetch_items(int type, const std::string& filter, size_t total,
+                              std::vector<LibraryIndex::Item>& out) {
+    std::string endpoint = section_endpoint(section, type) + filter;
+    PageFetcher pages([this, &endpoint](size_t start, size_t count, std::string& body,
+                                        const std::function<bool()>& abort) {
+        return fetch(endpoint + "&X-Plex-Container-Start=" + std::to_string(start) +
+                     "&X-Plex-Container-Size=" + std::to_string(count), body, abort) &&
+               PlexJSON::looks_like_json(body);
+    }, PAGE_SIZE, parallel);
+
+    // Parsed here on the sync thread, in list order
+    return pages.run(total, [&](std::string& body, size_t& list_total) {
+        PlexJSON::Value container = PlexJSON::parse(body)["MediaContainer"];
+        size_t received = 0;
+        container["Metadata"].for_each_element([&](const PlexJSON::Value& value) {
+            LibraryIndex::Item item = parse_item(type, value);
+            if (!item.id.empty()) out.push_back(std::move(item));
+            received++;
+            return true;
+        });
+        PlexJSON::Value size = container["totalSize"];
+        if (size.exists()) list_total = static_cast<size_t>(size.integer());
+        return received;
+    }, [this] { return abort_requested.load(); });
+}
+
+bool LibrarySync::sync_once() {
+    auto fail = [this](const std::string& message) {
+        std::lock_guard<std::mutex> lock(mutex);
+        state.error = message;
+        return false;
+    };
+
+    std::shared_ptr<const LibraryIndex> base = index();
+    size_t totals[3];
+    for (int k = 0; k < 3; ++k) {
+        if (!fetch_total(PLEX_TYPES[k], totals[k])) return fail("library size request failed");
+    }
+
+    // Deltas can't show deletions: when the server holds fewer items than the
+    // snapshot, start over
+    bool full = !base;
+    for (int k = 0; k < 3 && !full; ++k) {
+        full = totals[k] != LibraryIndex::npos && totals[k] < base->count(KINDS[k]);
+    }
+
+    std::vector<LibraryIndex::Item> items[3];
+    if (!full) {
+        std::string since = std::to_string(base->synced_at());
+        bool changed = false;
+        for (int k = 0; k < 3; ++k) {
+            std::vector<LibraryIndex::Item> delta;
+            if (!fetch_items(PLEX_TYPES[k], "&updatedAt%3E=" + since, LibraryIndex::npos, delta) ||
+                !fetch_items(PLEX_TYPES[k], "&addedAt%3E=" + since, LibraryIndex::npos, delta)) {
+                return fail("library delta request failed");
+            }
+
+            // Items at exactly synced_at come back every time; only real differences count
+            items[k] = base->items(KINDS[k]);
+            std::unordered_map<std::string, size_t> position;
+            position.reserve(items[k].size());
+            for (size_t i = 0; i < items[k].size(); ++i) {
+                position.emplace(items[k][i].id, i);
+            }
+            for (auto& item : delta) {
+                auto it = position.find(item.id);
+                if (it == position.end()) {
+                    position.emplace(item.id, items[k].size());
+                    items[k].push_back(std::move(item));
+                    changed = true;
+                } else if (items[k][it->second].updated_at != item.updated_at) {
+                    items[k][it->second] = std::move(item);
+                    changed = true;
+                }
+            }
+            // Counts still off (e.g. an item deleted and another added): start over
+            if (totals[k] != LibraryIndex::npos && items[k].size() != totals[k]) {
+                full = true;
+                break;
+            }
+        }
+        if (!full && !changed) {
+            return true;  // Snapshot is current
+        }
+    }
+    if (full) {
+        for (int k = 0; k < 3; ++k) {
+            items[k].clear();
+            if (!fetch_items(PLEX_TYPES[k], "", totals[k], items[k])) return fail("library request failed");
+        }
+    }
+
+    int64_t synced_at = 0;
+    for (const auto& list : items) {
+        for (const auto& item : list) {
+            synced_at = std::max(synced_at, item.updated_at);
+        }
+    }
+    if (!LibraryIndex::write(path, section, synced_at, items[0], items[1], items[2])) {
+        return fail("could not write " + path);
+    }
+    auto snapshot = LibraryIndex::open(path);
+    if (!snapshot) return fail("could not read back " + path);
+    publish(snapshot);
+    build_search(std::move(snapshot));
+    return true;
+}
+
+} // namespace PlexTUI
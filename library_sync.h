@@ -0,0 +1,96 @@
+#pragma once
+
+#include "library_index.h"
+#include "search_index.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace PlexTUI {
+
+/**
+ * Background sync of a music section into a LibraryIndex snapshot
+ * start() maps the last snapshot at once (browsing works before the network
+ * answers), then a worker thread brings it up to date: the first sync pages
+ * through every artist, album and track; later ones fetch only items with
+ * updatedAt / addedAt at or after the snapshot's newest timestamp, and fall
+ * back to a full pass when the server holds fewer items than the snapshot
+ * (deletions don't show up in delta queries), downloading several pages at a
+ * time (PageFetcher). Each sync that changed anything writes a new snapshot
+ * and swaps it in; readers keep whichever one they hold.
+ * The worker also builds each snapshot's SearchIndex, which follows shortly after.
+ */
+class LibrarySync {
+public:
+    // Blocking GET of a JSON endpoint; false on failure. abort() is polled while waiting.
+    using Fetch = std::function<bool(const std::string& endpoint, std::string& body,
+                                     const std::function<bool()>& abort)>;
+
+    struct Status {
+        bool syncing = false;
+        bool synced = false;        // Completed at least one sync this session
+        std::string error;          // Last failure ("" if the last sync worked)
+        size_t artists = 0;
+        size_t albums = 0;
+        size_t tracks = 0;
+    };
+
+    // parallel: pages requested at once (see PageFetcher)
+    LibrarySync(std::string snapshot_path, int section_id, Fetch fetch, int parallel = 4);
+    ~LibrarySync();  // Stops and joins the worker
+    LibrarySync(const LibrarySync&) = delete;
+    LibrarySync& operator=(const LibrarySync&) = delete;
+
+    // Load the snapshot and start syncing (every SYNC_INTERVAL after the first)
+    void start();
+
+    // Current snapshot (nullptr before the first one exists)
+    std::shared_ptr<const LibraryIndex> index() const;
+    uint64_t version() const { return index_version.load(); }  // Bumped on every swap
+
+    // Search index of the current snapshot (nullptr until built)
+    std::shared_ptr<const SearchIndex> search_index() const;
+
+    Status status() const;
+    int section_id() const { return section; }
+
+    static constexpr std::chrono::minutes SYNC_INTERVAL{15};
+    static constexpr int PAGE_SIZE = 500;
+
+private:
+    void run();
+    bool sync_once();
+
+    // All items of a Plex type (8 artist, 9 album, 10 track) matching filter, several
+    // pages at a time; total is the count when known (LibraryIndex::npos if not)
+    bool fetch_items(int type, const std::string& filter, size_t total, std::vector<LibraryIndex::Item>& out);
+    bool fetch_total(int type, size_t& total);
+
+    void publish(std::shared_ptr<const LibraryIndex> next);
+    void build_search(std::shared_ptr<const LibraryIndex> snapshot);
+
+    std::string path;
+    int section;
+    Fetch fetch;
+    int parallel;
+
+    mutable std::mutex mutex;
+    std::shared_ptr<const LibraryIndex> current;
+    std::shared_ptr<const SearchIndex> search;
+    Status state;
+    std::atomic<uint64_t> index_version{0};
+
+    std::thread worker;
+    std::condition_variable wake;
+    bool stopping = false;
+    std::atomic<bool> abort_requested{false};
+};
+
+} // namespace PlexTUI
@@ -3,11 +3,15 @@
 #include "input.h"
 #include "plex_client.h"
 #include "player_view.h"
+#include "audio_decoder.h"
+#include "art_cache.h"
 #include <iostream>
 #include <fstream>
 #include <iomanip>
+#include <algorithm>
 #include <chrono>
 #include <thread>
+#include <memory>
 #include <csignal>
 #include <cstdlib>
 #include <sys/ioctl.h>
@@ -213,6 +217,24 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
+    // Album art disk cache (lives as long as any AlbumArt)
+    std::unique_ptr<ArtCache> art_cache;
+    if (config.art_cache_mb > 0) {
+        std::string cache_dir = ArtCache::default_directory();
+        if (!cache_dir.empty()) {
+            art_cache = std::make_unique<ArtCache>(cache_dir, static_cast<size_t>(config.art_cache_mb) * 1024 * 1024);
+            AlbumArt::set_disk_cache(art_cache.get());
+        }
+    }
+    
+    // Pick the color depth before anything is drawn
+    ColorMode color_mode = Terminal::detect_color_mode();
+    if (config.color_mode != "auto" && !Terminal::parse_color_mode(config.color_mode, color_mode)) {
+        log_to_file("Unknown color_mode '" + config.color_mode + "', using auto");
+    }
+    Terminal::set_color_mode(color_mode);
+    AlbumArt::set_palette(config.art_palette, config.art_dither);
+    
     // Initialize components
     Terminal terminal;
     if (!terminal.init()) {
@@ -225,6 +247,19 @@ int main(int argc, char* argv[]) {
         terminal.set_window_size(config.window_width, config.window_height);
     }
     
+    // Album art as real pixels where the terminal supports it (before any art loads)
+    GraphicsProtocol graphics = terminal.graphics();
+    if (config.art_protocol == "kitty") graphics = GraphicsProtocol::Kitty;
+    else if (config.art_protocol == "sixel") graphics = GraphicsProtocol::Sixel;
+    else if (config.art_protocol == "blocks") graphics = GraphicsProtocol::None;
+    else if (config.art_protocol != "auto") {
+        log_to_file("Unknown art_protocol '" + config.art_protocol + "', using auto");
+    }
+    if (graphics == GraphicsProtocol::Sixel && terminal.cell_pixel_height() <= 0) {
+        graphics = GraphicsProtocol::None;  // Sixel needs the real cell size to fit its rect
+    }
+    AlbumArt::set_graphics(graphics, terminal.cell_pixel_width(), terminal.cell_pixel_height());
+    
     PlexClient* client = nullptr;
     // Only try to connect if we have server URL and token (not first run)
     if (!config.plex_server_url.empty() && !config.plex_token.empty()) {
@@ -238,6 +273,10 @@ int main(int argc, char* argv[]) {
                 std::cerr << "Check your server URL and authentication token.\n";
                 return 1;
             }
+            client->set_parallel_pages(config.parallel_pages);
+            if (config.library_sync) {
+                client->start_library_sync(LibraryIndex::default_directory());
+            }
         } catch (...) {
             terminal.restore();
             if (client) delete client;
@@ -278,10 +317,11 @@ int main(int argc, char* argv[]) {
     }
     
     // Main loop
-    const auto frame_duration = std::chrono::milliseconds(config.refresh_rate_ms);
+    auto next_frame = std::chrono::steady_clock::now();
     
     while (g_running) {
-        auto frame_start = std::chrono::steady_clock::now();
+        // refresh_rate_ms is the fastest we render; the terminal may ask for slower
+        const auto frame_duration = std::chrono::milliseconds(std::max(1, config.refresh_rate_ms));
         
         // Check if terminal is still valid (not closed)
         if (!input.is_terminal_valid()) {
@@ -344,8 +384,13 @@ int main(int argc, char* argv[]) {
             }
         }
         
-        // Render
-        if (player_view && client) {
+        // Render - only when a frame is due and the terminal has drained its backlog.
+        // Skipped frames coalesce naturally: the next draw() shows the latest state.
+        auto now = std::chrono::steady_clock::now();
+        bool frame_due = now >= next_frame;
+        if (frame_due && terminal.ready_for_frame() && player_view && client) {
+            next_frame = now + terminal.frame_interval(frame_duration);
+            frame_due = false;
             try {
                 player_view->draw();
             } catch (const std::exception& e) {
@@ -359,18 +404,15 @@ int main(int argc, char* argv[]) {
             }
         }
         
-        // Frame rate limiting - always sleep to prevent CPU spinning
-        auto frame_end = std::chrono::steady_clock::now();
-        auto frame_time = std::chrono::duration_cast<std::chrono::milliseconds>(
-            frame_end - frame_start
+        // Frame rate limiting - block in poll() instead of sleeping so keystrokes
+        // and output drain wake the loop immediately. A due frame held back by
+        // the backlog waits for the tty to become writable.
+        auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(
+            next_frame - std::chrono::steady_clock::now()
         );
-        
-        if (frame_time < frame_duration) {
-            std::this_thread::sleep_for(frame_duration - frame_time);
-        } else {
-            // Frame took longer than expected - still sleep a bit to prevent 100% CPU
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        }
+        int timeout_ms = frame_due ? static_cast<int>(frame_duration.count())
+                                   : static_cast<int>(std::clamp<long>(wait.count(), 1, frame_duration.count()));
+        terminal.wait_for_io(timeout_ms, client ? client->async_wake_fd() : -1);
     }
     
     // Cleanup - ensure all resources are freed in correct order
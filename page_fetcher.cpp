@@ -0,0 +1,113 @@
+#include "page_fetcher.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <chrono>
+
+namespace PlexTUI {
+
+PageFetcher::PageFetcher(Fetch fetch, size_t page_size, int parallel)
+    : fetch(std::move(fetch)), page_size(std::max<size_t>(1, page_size)),
+      parallel(std::clamp(parallel, 1, MAX_PARALLEL)) {
+}
+
+bool PageFetcher::run(size_t total, const Deliver& deliver, const std::function<bool()>& abort) {
+    struct Result {
+        bool ok = false;
+        std::string body;
+    };
+    auto pages_in = [this](size_t items) { return (items + page_size - 1) / page_size; };
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::map<size_t, Result> finished;  // Arrived, waiting for the pages before them
+    size_t next_page = 0;               // Next page a worker takes
+    size_t delivered = 0;               // Pages handed to deliver
+    size_t end_page = total == npos ? 1 : pages_in(total);  // Length unknown: the first page decides
+    std::atomic<bool> stopping{false};
+    auto cancelled = [&] { return stopping.load() || (abort && abort()); };
+
+    auto work = [&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            changed.wait(lock, [&] {
+                return stopping.load() ||
+                       (next_page < end_page && next_page < delivered + 2 * static_cast<size_t>(parallel));
+            });
+            if (stopping) return;
+            size_t page = next_page++;
+            lock.unlock();
+
+            Result result;
+            result.ok = fetch(page * page_size, page_size, result.body, cancelled);
+
+            lock.lock();
+            finished[page] = std::move(result);
+            changed.notify_all();
+        }
+    };
+    std::vector<std::thread> workers;
+    for (int i = 0; i < parallel; ++i) {
+        workers.emplace_back(work);
+    }
+
+    bool ok = true;
+    while (true) {
+        Result result;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (delivered >= end_page) break;
+            while (!finished.count(delivered) && !(abort && abort())) {
+                changed.wait_for(lock, std::chrono::milliseconds(100));  // Wake now and then to poll abort
+            }
+            auto it = finished.find(delivered);
+            if (it == finished.end()) {
+                ok = false;  // Aborted
+                break;
+            }
+            result = std::move(it->second);
+            finished.erase(it);
+        }
+
+        size_t items = 0;
+        if (result.ok) {
+            try {
+                items = deliver(result.body, total);
+            } catch (...) {
+                result.ok = false;
+            }
+        }
+        if (!result.ok) {
+            ok = false;
+            break;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        delivered++;
+        if (items < page_size) {
+            end_page = delivered;  // Short page: the list ends here
+        } else if (total != npos) {
+            end_page = pages_in(total);
+        } else {
+            end_page = npos;  // Long list of unknown length: until a short page
+        }
+        changed.notify_all();
+    }
+
+    // Pages past the end (or after a failure) are still in flight: cut them short
+    stopping = true;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        changed.notify_all();
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return ok;
+}
+
+} // namespace PlexTUI
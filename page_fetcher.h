@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <functional>
+#include <cstddef>
+
+namespace PlexTUI {
+
+/**
+ * Bulk download of a long paged list (X-Plex-Container-Start / -Size)
+ * Up to `parallel` worker threads request pages at once, each on its own pooled
+ * connection, and run() hands the bodies to the caller strictly in list order
+ * as soon as a page and every page before it are in, so a long list loads at
+ * the server's pace rather than one round trip per page. Workers stay at most
+ * 2 * parallel pages ahead of the caller. When the length isn't known up front
+ * the first page goes alone (a short list costs one request), and the list
+ * ends at the first short page.
+ */
+class PageFetcher {
+public:
+    // Blocking GET of items [start, start + count); false on failure. Runs on a
+    // worker thread; abort() turns true when the page is no longer wanted.
+    using Fetch = std::function<bool(size_t start, size_t count, std::string& body,
+                                     const std::function<bool()>& abort)>;
+    // One page's body, in order on the run() thread: returns how many items it
+    // held, and may set total (e.g. from totalSize)
+    using Deliver = std::function<size_t(std::string& body, size_t& total)>;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    PageFetcher(Fetch fetch, size_t page_size, int parallel);
+
+    // Every page from the start of the list to total (npos: unknown). False if a
+    // request failed or abort() returned true; it is polled from the worker
+    // threads as well, so it must be thread-safe.
+    bool run(size_t total, const Deliver& deliver, const std::function<bool()>& abort = nullptr);
+
+    static constexpr int MAX_PARALLEL = 16;
+
+private:
+    Fetch fetch;
+    size_t page_size;
+    int parallel;
+};
+
+} // namespace PlexTUI
@@ -6,13 +6,38 @@
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <cstdlib>
 #include <chrono>
 #include <set>
 #include <algorithm>
 #include <cctype>
+#include <cstdio>
+#include <string_view>
+#include <random>
 
 namespace PlexTUI {
 
+namespace {
+
+// Combines the state a section renders from into one comparable value
+class StateHash {
+public:
+    template <typename T>
+    StateHash& add(T v) { return mix(static_cast<uint64_t>(v)); }  // Integers, bools, enums
+    StateHash& add(std::string_view v) { return mix(std::hash<std::string_view>{}(v)); }
+    StateHash& add(const std::string& v) { return add(std::string_view(v)); }
+    uint64_t value() const { return h; }
+    
+private:
+    uint64_t h = 0xcbf29ce484222325ULL;
+    StateHash& mix(uint64_t v) {
+        h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        return *this;
+    }
+};
+
+} // namespace
+
 PlayerView::PlayerView(Terminal& term, PlexClient& client, Config& config)
     : term(term), client(client), config(config) {
     
@@ -27,14 +52,10 @@ PlayerView::PlayerView(Terminal& term, PlexClient& client, Config& config)
     scroll_offset = 0;
     search_active = false;
     search_pending = false;
-    last_search_time = std::chrono::steady_clock::now();
     browse_mode = BrowseMode::Artists;
     current_playlist_id.clear();
-    playlist_total_size = 0;
-    playlist_loaded_count = 0;
     is_search_mode = false;
     current_search_query.clear();
-    search_loaded_count = 0;
 }
 
 void PlayerView::update() {
@@ -48,6 +69,19 @@ void PlayerView::update() {
             return;
         }
         playback_state = client.get_playback_state();
+        client.run_async_completions();  // Library responses that arrived since the last frame
+        artists.retry();  // List pages whose request failed
+        albums.retry();
+        playlists.retry();
+        sidebar_playlists.retry();
+        browse_tracks.retry();
+        
+        // A new local library snapshot (first sync done, or the library changed):
+        // refresh the top-level lists, unless the user has drilled into one
+        if (client.get_library_index_version() != library_index_version && music_library_id > 0 &&
+            browse_mode == BrowseMode::Artists) {
+            load_library_data();
+        }
 
         if (pending_play) {
             auto now = std::chrono::steady_clock::now();
@@ -76,14 +110,10 @@ void PlayerView::update() {
                 }
                 pending_play = false;
             }
-            // Handle debounced search even when pending_play
+            // Handle pending search even when pending_play
             if (search_pending && search_active) {
-                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                    now - last_search_time).count();
-                if (elapsed >= 300) {
-                    perform_search();
-                    search_pending = false;
-                }
+                perform_search();
+                search_pending = false;
             }
             return;
         }
@@ -94,14 +124,11 @@ void PlayerView::update() {
             }
         }
 
+        // Keystrokes since the last frame make one search; a newer query
+        // cancels the older one's request, so there is no need to wait
         if (search_pending && search_active) {
-            auto now = std::chrono::steady_clock::now();
-            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                now - last_search_time).count();
-            if (elapsed >= 300) {
-                perform_search();
-                search_pending = false;
-            }
+            perform_search();
+            search_pending = false;
         }
 
         if (playback_state.playing) {
@@ -249,20 +276,19 @@ void PlayerView::update() {
                 }
 
                 // Prefetch lyrics for next track when possible
-                if (config.enable_lyrics && browse_mode == BrowseMode::Tracks && !browse_tracks.empty()) {
-                    int current_idx = -1;
-                    for (size_t i = 0; i < browse_tracks.size(); ++i) {
-                        if (browse_tracks[i].id == playback_state.current_track.id) {
-                            current_idx = static_cast<int>(i);
-                            break;
+                if (config.enable_lyrics) {
+                    const Track* next_track = nullptr;
+                    if (!shuffle_queue.empty()) {
+                        if (shuffle_position + 1 < shuffle_queue.size()) next_track = &shuffle_queue[shuffle_position + 1];
+                    } else if (browse_mode == BrowseMode::Tracks && !browse_tracks.empty()) {
+                        int current_idx = browse_tracks.held();  // Playing track's row (see select_item)
+                        if (current_idx >= 0 && browse_tracks.loaded(current_idx + 1)) {
+                            next_track = &browse_tracks[current_idx + 1];
                         }
                     }
-                    if (current_idx >= 0 && current_idx + 1 < static_cast<int>(browse_tracks.size())) {
-                        const Track& next_track = browse_tracks[current_idx + 1];
-                        if (next_track.id != prefetch_next_track_id && !next_track.id.empty()) {
-                            client.get_lyrics(next_track);
-                            prefetch_next_track_id = next_track.id;
-                        }
+                    if (next_track && next_track->id != prefetch_next_track_id && !next_track->id.empty()) {
+                        client.get_lyrics(*next_track);
+                        prefetch_next_track_id = next_track->id;
                     }
                 }
             } else {
@@ -292,6 +318,12 @@ void PlayerView::draw() {
         return;
     }
     
+    // Terminal dropped a frame under backpressure - what's on screen is stale
+    if (term.take_dropped_frame()) {
+        need_bg_fill = true;
+        AlbumArt::invalidate_uploads();  // The lost frame may have carried an image upload
+    }
+    
     // btop-style: Check minimum terminal size
     if (w < 80 || h < 24) {
         // Terminal too small - show warning message
@@ -336,7 +368,7 @@ void PlayerView::draw() {
                 if (music_library_id < 0) {
                     music_library_id = client.get_music_library_id();
                 }
-                if (music_library_id > 0 && playlists.empty()) {
+                if (music_library_id > 0 && !playlists.attached()) {
                     load_library_data();
                 }
             }
@@ -348,8 +380,17 @@ void PlayerView::draw() {
         }
     }
     
+    // Closing the options overlay leaves it on screen under unchanged sections
+    if (options_menu_active != last_options_menu_active) {
+        last_options_menu_active = options_menu_active;
+        if (!options_menu_active) {
+            need_bg_fill = true;
+        }
+    }
+    
     // Only fill background on first draw or view change (not every frame)
     if (need_bg_fill) {
+        invalidate_sections();
         // Fill entire screen with uniform black background
         int w = term.width();
         int h = term.height();
@@ -358,12 +399,9 @@ void PlayerView::draw() {
         if (h <= 0 || h > 1000) h = 24;  // Max reasonable height
         
         if (w > 0 && h > 0) {
-            std::string black_bg = term.bg_color(0, 0, 0);
-            std::string reset = term.reset_color();
             // Fill entire screen - border will be drawn last and overwrite border positions
             for (int y = 0; y < h; ++y) {
-                std::string line(w, ' ');
-                term.draw_text(0, y, black_bg + line + reset);
+                term.fill(0, y, w);
             }
         }
         need_bg_fill = false;
@@ -371,97 +409,220 @@ void PlayerView::draw() {
     
     auto layout = calculate_layout();
     
-    // Always draw colorful sidebar
-    draw_sidebar();
+    // The options overlay is drawn over every section - keep it all repainting while open
+    if (options_menu_active) {
+        invalidate_sections();
+    }
     
-    // Draw based on current view mode
-    // Always clear main content area first to remove fragments (btop-style)
     int sidebar_w = 30;
     // w and h already declared at top of function - reuse them
     // Safety check - ensure valid dimensions (btop-style: enforce reasonable limits)
     if (w <= 0 || w > 1000) w = 80;  // Max reasonable width
     if (h <= 0 || h > 1000) h = 24;  // Max reasonable height
     
-    // Clear main content area on view change to remove fragments (btop-style)
-    if (view_changed && w > sidebar_w && h > 0) {
-        std::string clear_bg = term.bg_color(0, 0, 0);
-        int main_w = w - sidebar_w;
-        if (main_w > 0 && main_w <= 1000) {
-            // Fill entire main content area with black to remove all fragments
-            // This includes album art area which can leave fragments
-            for (int y = 0; y < h - 1 && y < 1000; ++y) {  // Don't overwrite status bar
-                std::string line(main_w, ' ');
-                term.draw_text(sidebar_w, y, clear_bg + line + term.reset_color());
+    // Declare what each section depends on; unchanged sections cost nothing this frame
+    for (auto& s : sections) {
+        s.used = false;
+        s.dirty = false;
+    }
+    bool is_library = (current_view == ViewMode::Library || current_view == ViewMode::Search);
+    const Track& track = playback_state.current_track;
+    
+    mark_section(Section::Sidebar,
+                 StateHash().add(current_view).add(sidebar_playlists.size()).add(sidebar_playlists.version())
+                            .add(playlist_scroll_offset).value(),
+                 Rect{0, 0, sidebar_w, h - 1});
+    
+    if (is_library) {
+        update_library_art();
+        auto art_generation = [](const AlbumArt* art) -> uint64_t { return art ? art->generation() + 1 : 0; };
+        // Selection and scroll are left out: moving through the list is painted
+        // incrementally below rather than as a full repaint
+        mark_section(Section::Library,
+                     StateHash().add(browse_mode)
+                                .add(artists.size()).add(albums.size()).add(playlists.size()).add(browse_tracks.size())
+                                .add(artists.version()).add(albums.version()).add(playlists.version())
+                                .add(browse_tracks.version())
+                                .add(search_query).add(search_active).add(is_search_mode)
+                                .add(current_playlist_id).add(current_album_id).add(config.enable_album_art)
+                                .add(art_generation(client.get_album_art())).add(art_generation(artist_art.get()))
+                                .add(reinterpret_cast<uintptr_t>(artist_art.get()))
+                                .add(reinterpret_cast<uintptr_t>(album_art_for_tracks.get()))
+                                .add(art_generation(album_art_for_tracks.get()))
+                                .add(art_generation(album_art_for_albums.get())).value(),
+                     Rect{sidebar_w, 0, w - sidebar_w, h - 1});
+        
+        list_update.partial = false;
+        bool list_moved = selected_index != list_update.drawn_selected ||
+                          scroll_offset != list_update.drawn_scroll;
+        if (list_moved && !section(Section::Library).dirty) {
+            // The artist picture follows the selection, so that list repaints fully
+            if (browse_mode == BrowseMode::Artists && config.enable_album_art) {
+                section(Section::Library).dirty = true;
+            } else {
+                list_update.partial = true;
+                list_update.scroll_delta = scroll_offset - list_update.drawn_scroll;
+                list_update.prev_selected = list_update.drawn_selected;
             }
         }
+    } else {
+        const AlbumArt* art = client.get_album_art();
+        mark_section(Section::AlbumArt,
+                     StateHash().add(config.enable_album_art).add(art ? art->generation() + 1 : 0).value(),
+                     Rect{layout.album_art_x, layout.album_art_y, layout.album_art_w, layout.album_art_h});
+        
+        // Full rate: always repainted
+        section(Section::Waveform).valid = false;
+        mark_section(Section::Waveform, 0,
+                     Rect{layout.waveform_x, layout.waveform_y, layout.waveform_w, layout.waveform_h});
+        
+        int lyrics_top = layout.waveform_y + layout.waveform_h;
+        bool show_lyrics = lyrics_visible();
+        mark_section(Section::Lyrics,
+                     StateHash().add(show_lyrics).add(pending_play).add(track.id).add(last_lyrics_track_id)
+                                .add(current_lyrics.size()).add(synced_lyrics.size()).add(lyrics_lines.size())
+                                .add(current_synced_lyric_index()).add(lyrics_scroll_position).value(),
+                     Rect{layout.waveform_x, lyrics_top, layout.waveform_w, layout.track_info_y - 1 - lyrics_top});
+        
+        bool starting = cached_audio_levels.waveform_data.empty() || cached_audio_levels.current_level == 0.0f;
+        mark_section(Section::TrackInfo,
+                     StateHash().add(client.is_connected()).add(track.id).add(track.title).add(track.artist)
+                                .add(track.album).add(track.year).add(track.genre)
+                                .add(playback_state.playing).add(starting).value(),
+                     Rect{layout.track_info_x, layout.track_info_y, w - 1 - layout.track_info_x, 7});
+        
+        section(Section::Progress).valid = false;
+        mark_section(Section::Progress, 0,
+                     Rect{sidebar_w + 1, layout.progress_bar_y, w - sidebar_w - 2, 1});
         
-        // Explicitly clear album art area to remove fragments (btop-style: aggressive clearing)
-        // Clear both Player view album art position and Library view album art position
-        // layout is already calculated above, reuse it
-        if (layout.album_art_w > 0 && layout.album_art_h > 0) {
-            // Clear Player view album art area (top-left of main content)
-            if (layout.album_art_x >= 0 && layout.album_art_y >= 0 &&
-                layout.album_art_x + layout.album_art_w <= w &&
-                layout.album_art_y + layout.album_art_h <= h) {
-                for (int y = 0; y < layout.album_art_h; ++y) {
-                    std::string line(layout.album_art_w, ' ');
-                    term.draw_text(layout.album_art_x, layout.album_art_y + y, 
-                                  clear_bg + line + term.reset_color());
+        mark_section(Section::Controls, StateHash().add(playback_state.playing).value(),
+                     Rect{sidebar_w + 1, layout.controls_y, w - sidebar_w - 2, 4});
+    }
+    
+    mark_section(Section::StatusBar,
+                 StateHash().add(playback_state.playing).add(client.is_connected()).add(status_message).value(),
+                 Rect{0, layout.status_bar_y, w, 1});
+    
+    mark_section(Section::Chrome, StateHash().add(current_view).value(), Rect{});
+    
+    // A repainting section clears its rect, so whatever it overlaps has to
+    // repaint too (only happens on cramped terminals where sections collide)
+    bool spread = true;
+    while (spread) {
+        spread = false;
+        for (auto& a : sections) {
+            if (!a.used || !a.dirty) continue;
+            for (auto& b : sections) {
+                if (b.used && !b.dirty && a.rect.intersects(b.rect)) {
+                    b.dirty = true;
+                    spread = true;
                 }
             }
-            
-            // Also clear potential Library view album art area (top-right corner)
-            // Library view might draw album art in a different position
-            int lib_art_x = w - layout.album_art_w - 2;  // Top-right corner
-            int lib_art_y = 2;
-            if (lib_art_x >= sidebar_w && lib_art_x + layout.album_art_w <= w &&
-                lib_art_y >= 0 && lib_art_y + layout.album_art_h <= h) {
-                for (int y = 0; y < layout.album_art_h; ++y) {
-                    std::string line(layout.album_art_w, ' ');
-                    term.draw_text(lib_art_x, lib_art_y + y, 
-                                  clear_bg + line + term.reset_color());
-                }
+        }
+    }
+    
+    // Chrome (border, separators, title, menu bar) sits on top: repaint it whenever
+    // a section that was painted over any of its lines repaints
+    SectionState& chrome = section(Section::Chrome);
+    if (!chrome.dirty) {
+        const Rect chrome_lines[] = {
+            Rect{layout.title_x, layout.title_y, layout.waveform_w, 2},
+            Rect{sidebar_w, layout.track_info_y - 1, w - sidebar_w, 1},
+            Rect{0, layout.status_bar_y - 1, w, 1},
+        };
+        chrome.dirty = section(Section::Sidebar).dirty || section(Section::Library).dirty ||
+                       section(Section::StatusBar).dirty;
+        for (const auto& s : sections) {
+            if (chrome.dirty) break;
+            if (!s.used || !s.dirty || &s == &chrome) continue;
+            for (const Rect& line : chrome_lines) {
+                chrome.dirty = chrome.dirty || s.rect.intersects(line);
             }
         }
     }
     
-    // Draw top menu bar (btop-style: always visible at top)
-    draw_top_menu_bar();
+    // Paint in the original back-to-front order
+    if (section(Section::Sidebar).dirty) {
+        draw_sidebar();
+    }
     
-    // Draw view-specific content first (before border so border is always on top)
-    if (current_view == ViewMode::Library || current_view == ViewMode::Search) {
-        draw_library_view(layout);
+    if (is_library ? section(Section::Library).dirty : section(Section::AlbumArt).dirty) {
+        clear_art_images();
+    }
+    
+    if (is_library) {
+        if (section(Section::Library).dirty) {
+            draw_library_view(layout);  // Clears the whole main area itself
+        } else if (list_update.partial) {
+            draw_browse_list(layout);
+        }
+        list_update.partial = false;
+        list_update.drawn_selected = selected_index;
+        list_update.drawn_scroll = scroll_offset;
     } else {
         // Player view - btop style (black bg throughout)
-        // Ensure main content area has black background
-        if (w > sidebar_w && h > 0) {
-            std::string black_bg = term.bg_color(0, 0, 0);
-            int main_w = w - sidebar_w;
-            if (main_w > 0 && main_w <= 1000) {  // Additional safety check
-                for (int y = 0; y < h - 1 && y < 1000; ++y) {  // Don't overwrite status bar
-                    std::string line(main_w, ' ');
-                    term.draw_text(sidebar_w, y, black_bg + line + term.reset_color());
-                }
+        // Clear every damaged rect first, then paint, so overlapping sections
+        // layer exactly as they would on a fully cleared screen
+        for (Section s : {Section::AlbumArt, Section::Waveform, Section::Lyrics,
+                          Section::TrackInfo, Section::Progress, Section::Controls}) {
+            if (section(s).dirty) {
+                clear_rect(section(s).rect);
             }
         }
         
-        draw_album_art(layout);
-        draw_title(layout);  // Draw title above waveform
+        if (section(Section::AlbumArt).dirty) {
+            draw_album_art(layout);
+        }
         draw_waveform(layout);  // Draw waveform next to album art
-        draw_track_info(layout);
+        if (section(Section::Lyrics).dirty) {
+            // Draw scrolling lyrics under waveform (player view only, while playing)
+            // Allow lyrics to display even when paused (user might want to see them)
+            if (lyrics_visible()) {
+                try {
+                    draw_lyrics(layout);
+                } catch (const std::exception& e) {
+                    if (config.enable_debug_logging) {
+                        std::cerr << "[LOG] Exception in draw_lyrics(): " << e.what() << std::endl;
+                    }
+                } catch (...) {
+                    if (config.enable_debug_logging) {
+                        std::cerr << "[LOG] Unknown exception in draw_lyrics()" << std::endl;
+                    }
+                }
+            } else if (config.enable_lyrics && config.enable_debug_logging) {
+                if (playback_state.current_track.id.empty() && !pending_play) {
+                    std::cerr << "[LOG] Lyrics not drawn: no track ID" << std::endl;
+                } else if (!waveform) {
+                    std::cerr << "[LOG] Lyrics not drawn: no waveform" << std::endl;
+                } else if (!client.is_connected()) {
+                    std::cerr << "[LOG] Lyrics not drawn: client not connected" << std::endl;
+                }
+            }
+        }
+        if (section(Section::TrackInfo).dirty) {
+            draw_track_info(layout);
+        }
         draw_progress_bar(layout);
-        draw_controls(layout);
+        if (section(Section::Controls).dirty) {
+            draw_controls(layout);
+        }
     }
     
-    // Always draw status bar before border
-    draw_status_bar(layout);
+    // Status bar draws before the border
+    if (section(Section::StatusBar).dirty) {
+        draw_status_bar(layout);
+    }
     
     // ALWAYS draw border LAST so it's on top of everything (btop-style: border always visible)
     // This ensures the complete outer border (top, right, bottom, left) is always visible
-    draw_separators(layout);
-    
-    // Draw top menu bar AFTER border (btop-style: menu bar inside border at top)
-    draw_top_menu_bar();
+    if (chrome.dirty) {
+        if (!is_library) {
+            draw_title(layout);  // Title above waveform
+        }
+        draw_separators(layout);
+        // Top menu bar AFTER border (btop-style: menu bar inside border at top)
+        draw_top_menu_bar();
+    }
     
     // Draw options menu overlay if active (btop-style: draw on top)
     if (options_menu_active) {
@@ -471,6 +632,29 @@ void PlayerView::draw() {
     term.flush();
 }
 
+void PlayerView::mark_section(Section s, uint64_t state, const Rect& rect) {
+    SectionState& sec = section(s);
+    sec.used = true;
+    // A moved rect (resize) also counts as changed state
+    bool moved = rect.x != sec.rect.x || rect.y != sec.rect.y || rect.w != sec.rect.w || rect.h != sec.rect.h;
+    sec.dirty = !sec.valid || moved || sec.state != state;
+    sec.state = state;
+    sec.rect = rect;
+    sec.valid = true;
+}
+
+void PlayerView::invalidate_sections() {
+    for (auto& s : sections) {
+        s.valid = false;
+    }
+}
+
+void PlayerView::clear_rect(const Rect& rect) {
+    for (int y = rect.y; y < rect.y + rect.h; ++y) {
+        term.fill(rect.x, y, rect.w);
+    }
+}
+
 PlayerView::Layout PlayerView::calculate_layout() {
     Layout layout;
     
@@ -539,8 +723,7 @@ PlayerView::Layout PlayerView::calculate_layout() {
 
 void PlayerView::draw_separators(const Layout& layout) {
     // btop-style separators: orange box drawing characters with rounded corners
-    std::string black_bg = term.bg_color(0, 0, 0);
-    std::string orange_color = term.fg_color(255, 140, 0);  // Plex orange
+    const Theme::RGB orange{255, 140, 0};  // Plex orange
     
     int w = term.width();
     int h = term.height();
@@ -551,14 +734,23 @@ void PlayerView::draw_separators(const Layout& layout) {
     int sidebar_w = 30;
     
     // Unicode box drawing characters (btop style)
-    std::string hline = "─";  // Horizontal line
-    std::string vsep = "│";   // Vertical line
-    std::string top_left = "╭";
-    std::string top_right = "╮";
-    std::string bottom_left = "╰";
-    std::string bottom_right = "╯";
-    std::string left_conn = "├";
-    std::string right_conn = "┤";
+    const char* hline = "─";  // Horizontal line
+    const char* vsep = "│";   // Vertical line
+    const char* top_left = "╭";
+    const char* bottom_left = "╰";
+    const char* bottom_right = "╯";
+    const char* left_conn = "├";
+    const char* right_conn = "┤";
+    
+    // Horizontal runs are emitted as one positioned span instead of per-cell moves
+    auto draw_hline = [&](int x0, int y0, int len) {
+        if (len <= 0) return;
+        term.move_cursor(x0, y0);
+        term.write_bg(0, 0, 0);
+        term.write_fg(orange);
+        term.write_repeat(hline, len);
+        term.write_reset();
+    };
     
     // Draw complete border around entire application (btop style) - ALWAYS draw this
     // Safety check: ensure valid dimensions
@@ -566,36 +758,30 @@ void PlayerView::draw_separators(const Layout& layout) {
         // Top border with rounded corners (row 0)
         // Left corner is drawn here, the menu bar draws the line with options interruption
         if (w > 0) {
-            term.draw_text(0, 0, black_bg + orange_color + top_left + term.reset_color());
+            term.print(0, 0, orange, top_left);
         }
         
-        // Right corner will be drawn after menu bar
-        
         // Right corner will be drawn after menu bar completes the line
         
         // Second top line (mirror bottom twin lines) – row 1 (full width, no interruption)
         if (h > 2) {
-            for (int i = 1; i < w - 1 && i < w; ++i) {
-                term.draw_text(i, 1, black_bg + orange_color + hline + term.reset_color());
-            }
+            draw_hline(1, 1, w - 2);
         }
         
         // Left and right borders
         for (int y = 1; y < h - 1 && y < h; ++y) {
-            term.draw_text(0, y, black_bg + orange_color + vsep + term.reset_color());
+            term.print(0, y, orange, vsep);
             if (w - 1 >= 0 && w - 1 < w) {
-                term.draw_text(w - 1, y, black_bg + orange_color + vsep + term.reset_color());
+                term.print(w - 1, y, orange, vsep);
             }
         }
         
         // Bottom border with rounded corners
         if (h - 1 >= 0 && h - 1 < h) {
-            term.draw_text(0, h - 1, black_bg + orange_color + bottom_left + term.reset_color());
-            for (int i = 1; i < w - 1 && i < w; ++i) {
-                term.draw_text(i, h - 1, black_bg + orange_color + hline + term.reset_color());
-            }
+            term.print(0, h - 1, orange, bottom_left);
+            draw_hline(1, h - 1, w - 2);
             if (w - 1 >= 0 && w - 1 < w) {
-                term.draw_text(w - 1, h - 1, black_bg + orange_color + bottom_right + term.reset_color());
+                term.print(w - 1, h - 1, orange, bottom_right);
             }
         }
     }
@@ -604,7 +790,7 @@ void PlayerView::draw_separators(const Layout& layout) {
     // Start at y=2 to avoid interrupting the horizontal twin line at row 1
     if (sidebar_w > 0 && sidebar_w < w && h > 2) {
         for (int y = 2; y < h - 1 && y < h; ++y) {  // Start at y=2 to not interrupt top twin lines
-            term.draw_text(sidebar_w, y, black_bg + orange_color + vsep + term.reset_color());
+            term.print(sidebar_w, y, orange, vsep);
         }
     }
     
@@ -617,13 +803,11 @@ void PlayerView::draw_separators(const Layout& layout) {
             if (separator_y >= 1 && separator_y < h - 1 && separator_y < layout.status_bar_y) {
                 // Use connector characters for cleaner intersection
                 if (sidebar_w >= 0 && sidebar_w < w) {
-                    term.draw_text(sidebar_w, separator_y, black_bg + orange_color + left_conn + term.reset_color());
-                }
-                for (int i = sidebar_w + 1; i < w - 1 && i >= 0 && i < w; ++i) {
-                    term.draw_text(i, separator_y, black_bg + orange_color + hline + term.reset_color());
+                    term.print(sidebar_w, separator_y, orange, left_conn);
                 }
+                draw_hline(sidebar_w + 1, separator_y, w - 2 - sidebar_w);
                 if (w - 1 >= 0 && w - 1 < w) {
-                    term.draw_text(w - 1, separator_y, black_bg + orange_color + right_conn + term.reset_color());
+                    term.print(w - 1, separator_y, orange, right_conn);
                 }
             }
         }
@@ -632,9 +816,7 @@ void PlayerView::draw_separators(const Layout& layout) {
         if (layout.status_bar_y > 0 && layout.status_bar_y <= h) {
             int status_separator_y = layout.status_bar_y - 1;
             if (status_separator_y >= 1 && status_separator_y < h - 1) {
-                for (int i = 1; i < w - 1 && i >= 0 && i < w; ++i) {
-                    term.draw_text(i, status_separator_y, black_bg + orange_color + hline + term.reset_color());
-                }
+                draw_hline(1, status_separator_y, w - 2);
             }
         }
     }
@@ -648,9 +830,8 @@ void PlayerView::draw_top_menu_bar() {
     int h = term.height();
     if (w < 30 || h < 3) return;  // Too small
     
-    std::string black_bg = term.bg_color(0, 0, 0);
-    std::string orange_color = term.fg_color(255, 140, 0);  // Plex orange
-    std::string white = term.fg_color(255, 255, 255);
+    const Theme::RGB orange{255, 140, 0};  // Plex orange
+    const Theme::RGB white{255, 255, 255};
     
     // Draw on row 0, starting after left corner
     int menu_y = 0;
@@ -658,56 +839,48 @@ void PlayerView::draw_top_menu_bar() {
     
     // Format: ╭───┐options┌────────────────────────────
     // Top left corner (╭) is already drawn, so we start with ───┐
-    // All box characters and lines are orange
-    std::string box_left = "┌";
-    std::string box_hline = "─";
-    std::string options_label = orange_color + "o" + white + "ptions";  // 'o' in orange, rest white
-    
-    // Build: ───┐options┌ (all orange except 'ptions' text)
-    // Note: Top left corner ╭ is already drawn at x=0
-    std::string menu_item = orange_color + box_hline + box_hline + box_hline + "┐" + 
-                           options_label + 
-                           orange_color + box_left;
-    
-    // Calculate actual display width (excluding ANSI codes)
+    // All box characters and lines are orange, 'o' in orange, rest white
     // ───┐ = 4 chars, options = 7 chars, ┌ = 1 char = 12 chars total
     int menu_item_width = 4 + 7 + 1;  // ───┐ + "options" + ┌
     
     // Draw the menu item at row 0
-    term.draw_text(menu_x, menu_y, black_bg + menu_item + term.reset_color());
+    term.move_cursor(menu_x, menu_y);
+    term.write_bg(0, 0, 0);
+    term.write_fg(orange);
+    term.write("───┐o");
+    term.write_fg(white);
+    term.write("ptions");
+    term.write_fg(orange);
+    term.write("┌");
     
     // Continue the orange line after the menu item to fill remaining width
     int line_start_x = menu_x + menu_item_width;
-    for (int x = line_start_x; x < w - 1 && x < w; ++x) {
-        term.draw_text(x, menu_y, black_bg + orange_color + box_hline + term.reset_color());
-    }
+    term.write_repeat("─", std::max(0, w - 1 - line_start_x));
     
     // Draw right corner
-    if (w - 1 >= 0 && w - 1 < w) {
-        term.draw_text(w - 1, menu_y, black_bg + orange_color + "╮" + term.reset_color());
-    }
+    term.write("╮");
+    term.write_reset();
 }
 
 void PlayerView::draw_title(const Layout& layout) {
     // Draw application title above waveform (btop style)
-    std::string black_bg = term.bg_color(0, 0, 0);
-    std::string orange_color = term.fg_color(255, 140, 0);  // Plex orange
-    std::string title = "plex-tui";
+    const Theme::RGB orange{255, 140, 0};  // Plex orange
     
     // Only draw if title position is valid
     if (layout.title_y >= 0) {
         // Draw title
-        term.draw_text(layout.title_x, layout.title_y,
-                      black_bg + orange_color + title + term.reset_color());
+        term.print(layout.title_x, layout.title_y, orange, "plex-tui");
         
         // Draw single orange === line below title (btop style)
         int separator_y = layout.title_y + 1;
         if (separator_y >= 0 && separator_y < term.height()) {
             int separator_width = layout.waveform_w;
             if (separator_width > 0 && separator_width <= 1000) {
-                std::string separator_line(separator_width, '=');
-                term.draw_text(layout.title_x, separator_y,
-                              black_bg + orange_color + separator_line + term.reset_color());
+                term.move_cursor(layout.title_x, separator_y);
+                term.write_bg(0, 0, 0);
+                term.write_fg(orange);
+                term.write_repeat("=", separator_width);
+                term.write_reset();
             }
         }
     }
@@ -728,36 +901,27 @@ void PlayerView::draw_waveform(const Layout& layout) {
             }
         }
     }
+}
+
+int PlayerView::current_synced_lyric_index() const {
+    if (synced_lyrics.empty()) return -1;
     
-    // Draw scrolling lyrics under waveform (player view only, while playing)
+    // Last line whose timestamp has passed (lines are sorted by timestamp)
+    uint32_t current_pos_ms = playback_state.position_ms;
+    auto it = std::upper_bound(synced_lyrics.begin(), synced_lyrics.end(), current_pos_ms,
+                               [](uint32_t pos, const LyricLine& line) { return pos < line.timestamp_ms; });
+    if (it == synced_lyrics.begin()) {
+        return 0;  // Before first timestamp: show first line
+    }
+    return static_cast<int>(it - synced_lyrics.begin()) - 1;
+}
+
+bool PlayerView::lyrics_visible() {
     // Only draw if we have a valid track and waveform is visible
     // NOTE: Lyrics fetching is disabled due to curl thread-safety issues
     // Drawing will only show cached lyrics if they were previously fetched
-    // Allow lyrics to display even when paused (user might want to see them)
-    if (config.enable_lyrics && current_view == ViewMode::Player && waveform && client.is_connected() &&
-        (!playback_state.current_track.id.empty() || pending_play)) {
-        try {
-            draw_lyrics(layout);
-        } catch (const std::exception& e) {
-            if (config.enable_debug_logging) {
-                std::cerr << "[LOG] Exception in draw_lyrics(): " << e.what() << std::endl;
-            }
-        } catch (...) {
-            if (config.enable_debug_logging) {
-                std::cerr << "[LOG] Unknown exception in draw_lyrics()" << std::endl;
-            }
-        }
-    } else if (config.enable_lyrics && config.enable_debug_logging) {
-        if (current_view != ViewMode::Player) {
-            std::cerr << "[LOG] Lyrics not drawn: wrong view mode" << std::endl;
-        } else if (playback_state.current_track.id.empty() && !pending_play) {
-            std::cerr << "[LOG] Lyrics not drawn: no track ID" << std::endl;
-        } else if (!waveform) {
-            std::cerr << "[LOG] Lyrics not drawn: no waveform" << std::endl;
-        } else if (!client.is_connected()) {
-            std::cerr << "[LOG] Lyrics not drawn: client not connected" << std::endl;
-        }
-    }
+    return config.enable_lyrics && current_view == ViewMode::Player && waveform && client.is_connected() &&
+           (!playback_state.current_track.id.empty() || pending_play);
 }
 
 void PlayerView::draw_album_art(const Layout& layout) {
@@ -777,6 +941,9 @@ void PlayerView::draw_album_art(const Layout& layout) {
     // Wrap entire function in try-catch to prevent crashes
     try {
         AlbumArt* art = client.get_album_art();
+        if (art) {
+            art->set_display_size(layout.album_art_w, layout.album_art_h);  // Sizes the next fetch
+        }
         
         if (!art || !art->has_art()) {
             // Draw pixelated Plex logo placeholder (btop style) - only in player view
@@ -795,9 +962,15 @@ void PlayerView::draw_album_art(const Layout& layout) {
                 return;
             }
             
+            // Pixel graphics replace the half-block lines entirely
+            if (AlbumArt::graphics() != GraphicsProtocol::None) {
+                draw_art_image(*art, layout.album_art_x, layout.album_art_y, layout.album_art_w, layout.album_art_h);
+                return;
+            }
+            
             // Render pixelated album art (already has black bg in render_pixelated)
             try {
-                auto art_lines = art->render_pixelated(layout.album_art_w, layout.album_art_h, config.theme);
+                const auto& art_lines = art->render_pixelated(layout.album_art_w, layout.album_art_h, config.theme);
                 
                 // Validate art_lines before drawing
                 if (art_lines.empty()) {
@@ -838,14 +1011,45 @@ void PlayerView::draw_album_art(const Layout& layout) {
     }
 }
 
+void PlayerView::draw_art_image(AlbumArt& art, int x, int y, int w, int h) {
+    int term_w = term.width();
+    int term_h = term.height();
+    if (x < 0 || y < 0 || x >= term_w || y >= term_h || w <= 0 || h <= 0) return;
+    
+    if (AlbumArt::graphics() == GraphicsProtocol::None) {
+        const auto& art_lines = art.render_pixelated(w, h, config.theme);
+        for (size_t row = 0; row < art_lines.size() && row < static_cast<size_t>(h); ++row) {
+            if (y + static_cast<int>(row) < term_h) {
+                term.draw_text(x, y + static_cast<int>(row), art_lines[row]);
+            }
+        }
+        return;
+    }
+    
+    // An image would cover the options overlay rather than sit under it
+    if (options_menu_active) return;
+    
+    // The whole image has to fit: a sixel reaching the last row scrolls the screen
+    w = std::min(w, term_w - x);
+    h = std::min(h, term_h - 1 - y);
+    if (h <= 0) return;
+    term.move_cursor(x, y);
+    term.write(art.render_graphics(w, h));
+}
+
+void PlayerView::clear_art_images() {
+    if (AlbumArt::graphics() != GraphicsProtocol::Kitty) return;
+    std::string retired;
+    AlbumArt::append_retired_images(retired);
+    term.write(retired);
+    term.write("\033_Ga=d,d=a,q=2\033\\");  // Placements only - uploaded images stay for reuse
+}
+
 void PlayerView::draw_plex_logo_placeholder(const Layout& layout) {
     // Render "PLEX" text in solid blocks (btop-style, like BTOP logo)
     // P, L, E are white; X has white left diagonal and orange right diagonal (>) with orange center
-    std::string black_bg = term.bg_color(0, 0, 0);
-    
-    // Colors
-    std::string white_color = term.fg_color(255, 255, 255);
-    std::string orange_color = term.fg_color(255, 140, 0);  // Plex orange
+    const Theme::RGB white_color{255, 255, 255};
+    const Theme::RGB orange_color{255, 140, 0};  // Plex orange
     
     // Center the text
     int center_x = layout.album_art_w / 2;
@@ -930,7 +1134,7 @@ void PlayerView::draw_plex_logo_placeholder(const Layout& layout) {
                 if (filled) {
                     // Determine color: white for P, L, E, and left diagonal of X
                     // Orange for right diagonal (>) and center of X
-                    std::string color = white_color;
+                    Theme::RGB color = white_color;
                     
                     if (is_x) {
                         // X pattern analysis:
@@ -957,7 +1161,7 @@ void PlayerView::draw_plex_logo_placeholder(const Layout& layout) {
                     }
                     
                     // Draw solid block (█)
-                    term.draw_text(draw_x, draw_y, black_bg + color + "█" + term.reset_color());
+                    term.print(draw_x, draw_y, color, "█");
                 }
             }
         }
@@ -973,85 +1177,57 @@ void PlayerView::draw_track_info(const Layout& layout) {
     const Track& track = playback_state.current_track;
     
     if (track.title.empty()) {
-        std::string msg = "No track playing";
-        std::string color = term.fg_color(150, 150, 150);
-        std::string black_bg = term.bg_color(0, 0, 0);
-        term.draw_text(layout.track_info_x, layout.track_info_y, 
-                      black_bg + color + msg + term.reset_color());
+        term.print(layout.track_info_x, layout.track_info_y, Theme::RGB(150, 150, 150), "No track playing");
         return;
     }
     
     // btop style: black background for all text
-    std::string black_bg = term.bg_color(0, 0, 0);
-    
     // Title - Large and bright white
-    std::string title_color = term.fg_color(255, 255, 255);
-    std::string title_text = track.title;
-    if (title_text.length() > 40) {
-        title_text = title_text.substr(0, 37) + "...";
-    }
-    term.draw_text(layout.track_info_x, layout.track_info_y,
-                  black_bg + title_color + title_text + term.reset_color());
+    term.print_clipped(layout.track_info_x, layout.track_info_y,
+                       Theme::RGB(255, 255, 255), track.title, 40);
     
     // Artist - Bright white
-    std::string artist_color = term.fg_color(220, 220, 220);
-    std::string artist_text = track.artist;
-    if (artist_text.length() > 40) {
-        artist_text = artist_text.substr(0, 37) + "...";
-    }
-    term.draw_text(layout.track_info_x, layout.track_info_y + 2,
-                  black_bg + artist_color + artist_text + term.reset_color());
+    term.print_clipped(layout.track_info_x, layout.track_info_y + 2,
+                       Theme::RGB(220, 220, 220), track.artist, 40);
     
     // Album - Dim white
-    std::string album_color = term.fg_color(180, 180, 180);
-    std::string album_text = track.album;
-    if (album_text.length() > 40) {
-        album_text = album_text.substr(0, 37) + "...";
-    }
-    term.draw_text(layout.track_info_x, layout.track_info_y + 4,
-                  black_bg + album_color + album_text + term.reset_color());
+    term.print_clipped(layout.track_info_x, layout.track_info_y + 4,
+                       Theme::RGB(180, 180, 180), track.album, 40);
     
     // Show decoding/playback status
     if (client.is_connected() && !playback_state.current_track.title.empty()) {
-        std::string status_text;
-        std::string status_color;
+        const char* status_text;
+        Theme::RGB status_color;
         
         // Check if actually decoding
         if (playback_state.playing) {
             // Use cached audio levels to avoid multiple calls per frame
             if (cached_audio_levels.waveform_data.empty() || cached_audio_levels.current_level == 0.0f) {
                 status_text = "Starting playback...";
-                status_color = term.fg_color(255, 200, 100);  // Orange/yellow
+                status_color = Theme::RGB(255, 200, 100);  // Orange/yellow
             } else {
                 status_text = "Playing";
-                status_color = term.fg_color(100, 255, 150);  // Green
+                status_color = Theme::RGB(100, 255, 150);  // Green
             }
         } else {
             status_text = "Paused";
-            status_color = term.fg_color(200, 200, 200);  // Gray
+            status_color = Theme::RGB(200, 200, 200);  // Gray
         }
         
-        std::string black_bg = term.bg_color(0, 0, 0);
-        term.draw_text(layout.track_info_x, layout.track_info_y + 6,
-                      black_bg + status_color + status_text + term.reset_color());
+        term.print(layout.track_info_x, layout.track_info_y + 6, status_color, status_text);
     }
     
     // Metadata - Dimmed but colorful
     if (track.year > 0 || !track.genre.empty()) {
-        std::string meta_color = term.fg_color(config.theme.dimmed.r,
-                                              config.theme.dimmed.g,
-                                              config.theme.dimmed.b);
-        std::string meta = "";
-        if (track.year > 0) meta += std::to_string(track.year);
+        term.move_cursor(layout.track_info_x, layout.track_info_y + 6);
+        term.write_bg(0, 0, 0);
+        term.write_fg(config.theme.dimmed);
+        if (track.year > 0) term.write_int(track.year);
         if (!track.genre.empty()) {
-            if (!meta.empty()) meta += " • ";
-            meta += track.genre;
-        }
-        if (!meta.empty()) {
-            std::string black_bg = term.bg_color(0, 0, 0);
-            term.draw_text(layout.track_info_x, layout.track_info_y + 6,
-                          black_bg + meta_color + meta + term.reset_color());
+            if (track.year > 0) term.write(" • ");
+            term.write(track.genre);
         }
+        term.write_reset();
     }
 }
 
@@ -1069,20 +1245,26 @@ void PlayerView::draw_progress_bar(const Layout& layout) {
     int bar_y = layout.progress_bar_y;  // Use layout position
     
     // Time labels - colorful with black background (btop style)
-    std::string black_bg = term.bg_color(0, 0, 0);
-    std::string time_color = term.fg_color(config.theme.warning.r, config.theme.warning.g, config.theme.warning.b);
-    std::string current_time = format_time(playback_state.position_ms);
-    std::string total_time = format_time(track.duration_ms);
-    
-    term.draw_text(bar_x, bar_y, black_bg + time_color + current_time + term.reset_color());
-    term.draw_text(bar_x + bar_width - 5, bar_y, black_bg + time_color + total_time + term.reset_color());
+    term.print(bar_x, bar_y, config.theme.warning, format_time(playback_state.position_ms));
+    term.print(bar_x + bar_width - 5, bar_y, config.theme.warning, format_time(track.duration_ms));
     
     // Progress bar with gradient colors
     float progress = static_cast<float>(playback_state.position_ms) / track.duration_ms;
     int filled = static_cast<int>(progress * bar_width);
     
+    // The bar is one contiguous run: position once, then only emit color changes
+    term.move_cursor(bar_x + 6, bar_y);
+    term.write_bg(0, 0, 0);
+    
     // Gradient: cyan -> magenta -> yellow
     for (int i = 0; i < bar_width; ++i) {
+        if (i >= filled) {
+            // Empty remainder shares one color
+            term.write_fg(40, 40, 40);
+            term.write_repeat("░", bar_width - i);
+            break;
+        }
+        
         float pos = static_cast<float>(i) / bar_width;
         uint8_t r, g, b;
         
@@ -1111,16 +1293,10 @@ void PlayerView::draw_progress_bar(const Layout& layout) {
             b = config.theme.waveform_tertiary.b;
         }
         
-        std::string bar_color = term.fg_color(r, g, b);
-        std::string empty_color = term.fg_color(40, 40, 40);
-        std::string black_bg = term.bg_color(0, 0, 0);
-        
-        if (i < filled) {
-            term.draw_text(bar_x + 6 + i, bar_y, black_bg + bar_color + "█" + term.reset_color());
-        } else {
-            term.draw_text(bar_x + 6 + i, bar_y, black_bg + empty_color + "░" + term.reset_color());
-        }
+        term.write_fg(r, g, b);
+        term.write("█");
     }
+    term.write_reset();
 }
 
 void PlayerView::draw_sidebar() {
@@ -1132,41 +1308,35 @@ void PlayerView::draw_sidebar() {
     if (sidebar_w <= 0) sidebar_w = 30;
     
     // Draw sidebar background (slightly lighter than main, but still dark)
-    std::string sidebar_bg = term.bg_color(10, 10, 10);
+    const Theme::RGB sidebar_bg{10, 10, 10};
     // Safety check for sidebar width
     if (sidebar_w > 0 && sidebar_w <= 1000 && h > 0 && h <= 1000) {
         int max_y = std::max(1, h - 1);
         for (int y = 0; y < max_y && y < 1000; ++y) {
-            std::string line(sidebar_w, ' ');
-            term.draw_text(0, y, sidebar_bg + line + term.reset_color());
+            term.fill(0, y, sidebar_w, sidebar_bg);
         }
     }
     
     // Bright menu items (white text)
     int y = 2;
-    std::string bright_white = term.fg_color(255, 255, 255);
-    std::string dim_white = term.fg_color(180, 180, 180);
+    const Theme::RGB bright_white{255, 255, 255};
+    const Theme::RGB dim_white{180, 180, 180};
     
     // btop style: black background for all text
-    std::string black_bg = term.bg_color(0, 0, 0);
-    
     // Home/Player
-    std::string home_color = (current_view == ViewMode::Player) ? bright_white : dim_white;
-    term.draw_text(2, y++, black_bg + home_color + "Player" + term.reset_color());
+    term.print(2, y++, (current_view == ViewMode::Player) ? bright_white : dim_white, "Player");
     
     // Library
-    std::string lib_color = (current_view == ViewMode::Library || current_view == ViewMode::Search) ? bright_white : dim_white;
-    term.draw_text(2, y++, black_bg + lib_color + "Library" + term.reset_color());
+    term.print(2, y++, (current_view == ViewMode::Library || current_view == ViewMode::Search) ? bright_white : dim_white,
+               "Library");
     
     // Search
-    std::string search_color = (current_view == ViewMode::Search) ? bright_white : dim_white;
-    term.draw_text(2, y++, black_bg + search_color + "Search" + term.reset_color());
+    term.print(2, y++, (current_view == ViewMode::Search) ? bright_white : dim_white, "Search");
     
     y += 2;
     
     // Playlists section header
-    std::string header_color = term.fg_color(150, 150, 150);
-    term.draw_text(2, y++, black_bg + header_color + "PLAYLISTS" + term.reset_color());
+    term.print(2, y++, Theme::RGB(150, 150, 150), "PLAYLISTS");
     
     // Show playlists with scrolling support
     int playlist_y = y;
@@ -1174,23 +1344,24 @@ void PlayerView::draw_sidebar() {
     if (max_visible_playlists < 1) max_visible_playlists = 1;
     
     // Calculate scroll range for playlists
-    int max_playlist_scroll = std::max(0, static_cast<int>(playlists.size()) - max_visible_playlists);
+    int max_playlist_scroll = std::max(0, sidebar_playlists.size() - max_visible_playlists);
     if (playlist_scroll_offset > max_playlist_scroll) {
         playlist_scroll_offset = max_playlist_scroll;
     }
     if (playlist_scroll_offset < 0) playlist_scroll_offset = 0;
     
     int visible_start = playlist_scroll_offset;
-    int visible_end = std::min(visible_start + max_visible_playlists, static_cast<int>(playlists.size()));
+    int visible_end = std::min(visible_start + max_visible_playlists, sidebar_playlists.size());
+    sidebar_playlists.show(visible_start, max_visible_playlists);
     
     for (int i = visible_start; i < visible_end; ++i) {
-        if (i >= static_cast<int>(playlists.size())) break;
-        
-        std::string pl_color = dim_white;
-        std::string name = playlists[i].title;
-        if (name.length() > 25) name = name.substr(0, 22) + "...";
         // btop style: black background for playlist items
-        term.draw_text(2, playlist_y + (i - visible_start), black_bg + pl_color + "  " + name + term.reset_color());
+        term.move_cursor(2, playlist_y + (i - visible_start));
+        term.write_bg(0, 0, 0);
+        term.write_fg(dim_white);
+        term.write("  ");
+        term.write_clipped(sidebar_playlists.loaded(i) ? std::string_view(sidebar_playlists[i].title) : "…", 25);
+        term.write_reset();
     }
 }
 
@@ -1199,31 +1370,21 @@ void PlayerView::draw_controls(const Layout& layout) {
     int w = term.width();
     if (w <= 0) w = 80;
     int center_x = w / 2;
-    std::string black_bg = term.bg_color(0, 0, 0);
     
-    std::string prev_color = term.fg_color(config.theme.foreground.r, config.theme.foreground.g, config.theme.foreground.b);
-    std::string play_color = playback_state.playing ?
-        term.fg_color(config.theme.success.r, config.theme.success.g, config.theme.success.b) :
-        term.fg_color(config.theme.highlight.r, config.theme.highlight.g, config.theme.highlight.b);
-    std::string next_color = term.fg_color(config.theme.foreground.r, config.theme.foreground.g, config.theme.foreground.b);
+    const Theme::RGB& play_color = playback_state.playing ? config.theme.success : config.theme.highlight;
     
-    term.draw_text(center_x - 8, controls_y, black_bg + prev_color + "⏮" + term.reset_color());
-    term.draw_text(center_x - 2, controls_y, black_bg + play_color + (playback_state.playing ? "⏸" : "▶") + term.reset_color());
-    term.draw_text(center_x + 4, controls_y, black_bg + next_color + "⏭" + term.reset_color());
+    term.print(center_x - 8, controls_y, config.theme.foreground, "⏮");
+    term.print(center_x - 2, controls_y, play_color, playback_state.playing ? "⏸" : "▶");
+    term.print(center_x + 4, controls_y, config.theme.foreground, "⏭");
     
     // Speaker icon only (no 100%); one line above Playing
-    std::string vol_color = term.fg_color(config.theme.warning.r, config.theme.warning.g, config.theme.warning.b);
-    term.draw_text(layout.controls_x, controls_y + 1, black_bg + vol_color + "🔊" + term.reset_color());
+    term.print(layout.controls_x, controls_y + 1, config.theme.warning, "🔊");
     
     // Playing/Paused (green) below speaker
-    std::string playing_text = playback_state.playing ? "Playing" : "Paused";
-    term.draw_text(layout.controls_x, controls_y + 2,
-                  black_bg + play_color + playing_text + term.reset_color());
-    
-    std::string hint_color = term.fg_color(config.theme.dimmed.r, config.theme.dimmed.g, config.theme.dimmed.b);
-    term.draw_text(layout.controls_x, controls_y + 3,
-                  black_bg + hint_color + "p:play  space:pause  s:stop  L:library  /:search  q:quit" +
-                  term.reset_color());
+    term.print(layout.controls_x, controls_y + 2, play_color, playback_state.playing ? "Playing" : "Paused");
+    
+    term.print(layout.controls_x, controls_y + 3, config.theme.dimmed,
+               "p:play  space:pause  s:stop  L:library  /:search  q:quit");
 }
 
 // Strip ANSI escape sequences from a string to prevent color code artifacts
@@ -1256,8 +1417,7 @@ static std::string strip_ansi_escape_sequences(const std::string& str) {
 
 void PlayerView::draw_status_bar(const Layout& layout) {
     // Status bar with btop-style orange corners and center divider
-    std::string black_bg = term.bg_color(0, 0, 0);
-    std::string orange_color = term.fg_color(255, 140, 0);  // Plex orange
+    const Theme::RGB orange{255, 140, 0};  // Plex orange
     
     int w = term.width();
     // Safety check - ensure valid dimensions (btop-style: enforce reasonable limits)
@@ -1272,27 +1432,20 @@ void PlayerView::draw_status_bar(const Layout& layout) {
     
     // Fill entire status bar with black background (validate width first)
     if (w > 0 && w <= 1000) {  // Safety check
-        std::string bar(w, ' ');
-        term.draw_text(0, y, black_bg + bar + term.reset_color());
+        term.fill(0, y, w);
     }
     
     // Draw orange corners (btop style)
-    std::string bottom_left = "╰";
-    std::string bottom_right = "╯";
-    std::string vsep = "│";  // Vertical separator for center divider
-    
     // Left corner
-    term.draw_text(0, y, black_bg + orange_color + bottom_left + term.reset_color());
+    term.print(0, y, orange, "╰");
     
     // Right corner
-    term.draw_text(w - 1, y, black_bg + orange_color + bottom_right + term.reset_color());
+    term.print(w - 1, y, orange, "╯");
     
-    std::string play_status = playback_state.playing ? "* Playing" : "  Paused";
-    std::string play_color = playback_state.playing ?
-        term.fg_color(100, 255, 150) : term.fg_color(200, 200, 200);
-    std::string conn_status = client.is_connected() ? "* Connected" : "  Disconnected";
-    std::string conn_color = client.is_connected() ?
-        term.fg_color(100, 255, 150) : term.fg_color(255, 100, 100);
+    std::string_view play_status = playback_state.playing ? "* Playing" : "  Paused";
+    Theme::RGB play_color = playback_state.playing ? Theme::RGB(100, 255, 150) : Theme::RGB(200, 200, 200);
+    std::string_view conn_status = client.is_connected() ? "* Connected" : "  Disconnected";
+    Theme::RGB conn_color = client.is_connected() ? Theme::RGB(100, 255, 150) : Theme::RGB(255, 100, 100);
     
     int center_x = w / 2;
     int status_x = w - 1 - static_cast<int>(conn_status.length()) - 1;
@@ -1300,21 +1453,34 @@ void PlayerView::draw_status_bar(const Layout& layout) {
     // Truncate msg so left side never overwrites "Connected" on the right
     int max_msg_len = std::max(0, status_x - 3 - static_cast<int>(play_status.length()));
     // Strip any ANSI escape sequences from status_message to prevent color code artifacts
-    std::string msg = status_message.empty() ? "Ready" : strip_ansi_escape_sequences(status_message);
-    if (static_cast<int>(msg.length()) > max_msg_len)
-        msg = msg.substr(0, static_cast<size_t>(max_msg_len > 3 ? max_msg_len - 3 : 0)) + "...";
-    std::string status_fg = term.fg_color(255, 255, 255);
-    
-    std::string left_status = black_bg + play_color + play_status + term.reset_color() +
-                              black_bg + " " + status_fg + msg + term.reset_color();
-    term.draw_text(2, y, left_status);
-    
-    int left_text_end = 2 + static_cast<int>(play_status.length()) + 1 + static_cast<int>(msg.length());
+    // (cached - the message changes rarely, the status bar is drawn every frame)
+    if (status_message != status_message_source) {
+        status_message_source = status_message;
+        status_message_plain = strip_ansi_escape_sequences(status_message);
+    }
+    std::string_view msg = status_message.empty() ? std::string_view("Ready") : std::string_view(status_message_plain);
+    int msg_len = static_cast<int>(msg.length());
+    if (msg_len > max_msg_len) {
+        msg_len = max_msg_len;  // write_clipped keeps exactly max_msg_len columns
+    }
+    
+    term.move_cursor(2, y);
+    term.write_bg(0, 0, 0);
+    term.write_fg(play_color);
+    term.write(play_status);
+    term.write_reset();
+    term.write_bg(0, 0, 0);
+    term.write(" ");
+    term.write_fg(255, 255, 255);
+    term.write_clipped(msg, max_msg_len);
+    term.write_reset();
+    
+    int left_text_end = 2 + static_cast<int>(play_status.length()) + 1 + msg_len;
     int right_text_start = w - 1 - static_cast<int>(conn_status.length()) - 2;
     if (left_text_end < center_x && center_x < right_text_start)
-        term.draw_text(center_x, y, black_bg + orange_color + vsep + term.reset_color());
+        term.print(center_x, y, orange, "│");
     
-    term.draw_text(status_x, y, black_bg + conn_color + conn_status + term.reset_color());
+    term.print(status_x, y, conn_color, conn_status);
 }
 
 void PlayerView::handle_input(const InputEvent& event) {
@@ -1334,7 +1500,7 @@ void PlayerView::handle_input(const InputEvent& event) {
                         playlist_scroll_offset--;
                     }
                 } else if (event.mouse.button == MouseEvent::Button::ScrollDown) {
-                    int max_scroll = std::max(0, static_cast<int>(playlists.size()) - 5);
+                    int max_scroll = std::max(0, sidebar_playlists.size() - 5);
                     if (playlist_scroll_offset < max_scroll) {
                         playlist_scroll_offset++;
                     }
@@ -1353,6 +1519,21 @@ void PlayerView::handle_input(const InputEvent& event) {
                 }
                 return;
             }
+            if ((current_view == ViewMode::Library || current_view == ViewMode::Search) &&
+                event.mouse.x >= 30) {
+                // Scrolling the browse list, selection dragged along to stay visible
+                int max_items = std::max(1, term.height() - 6 - 3);
+                int max_scroll = std::max(0, browse_item_count() - max_items);
+                int step = (event.mouse.button == MouseEvent::Button::ScrollUp) ? -3 : 3;
+                scroll_offset = std::clamp(scroll_offset + step, 0, max_scroll);
+                int old_index = selected_index;
+                selected_index = std::clamp(selected_index, scroll_offset, scroll_offset + max_items - 1);
+                selected_index = std::min(selected_index, std::max(0, browse_item_count() - 1));
+                if (browse_mode == BrowseMode::Albums && old_index != selected_index && album_art_for_albums) {
+                    album_art_for_albums->clear();
+                }
+                return;
+            }
         }
         
         // Check for clicks on top menu bar (btop-style: clickable menu items)
@@ -1393,13 +1574,9 @@ void PlayerView::handle_input(const InputEvent& event) {
                 search_active = false;
                 if (search_query.empty()) {
                     browse_tracks.clear();
-                    // Clear search/playlist pagination
                     is_search_mode = false;
                     current_search_query.clear();
-                    search_loaded_count = 0;
                     current_playlist_id.clear();
-                    playlist_total_size = 0;
-                    playlist_loaded_count = 0;
                     search_pending = false;
                 }
                 return;
@@ -1436,71 +1613,38 @@ void PlayerView::handle_input(const InputEvent& event) {
         }
         
         switch (event.key) {
-            case Key::Up: {
-                if (current_view == ViewMode::Player && synced_lyrics.empty() && !lyrics_lines.empty()) {
-                    if (lyrics_scroll_position > 0) lyrics_scroll_position--;
-                    return;
-                }
-            }
-                if (selected_index > 0) {
-                    int old_index = selected_index;
-                    selected_index--;
-                    // Clear album art when changing selection to prevent stale data
-                    if (browse_mode == BrowseMode::Albums && old_index != selected_index && album_art_for_albums) {
-                        album_art_for_albums->clear();
-                    }
-                    // Update scroll offset to keep selection visible
-                    if (selected_index < scroll_offset) {
-                        scroll_offset = selected_index;
-                    }
-                }
-                break;
-            case Key::Down: {
-                if (current_view == ViewMode::Player && synced_lyrics.empty() && !lyrics_lines.empty()) {
-                    const int visible = 5;  // Match lyrics_lines reservation
-                    int max_scroll = std::max(0, static_cast<int>(lyrics_lines.size()) - visible);
-                    if (lyrics_scroll_position < max_scroll) lyrics_scroll_position++;
-                    return;
-                }
-            }
-            case Key::PageUp: {
-                if (current_view == ViewMode::Player && synced_lyrics.empty() && !lyrics_lines.empty()) {
-                    lyrics_scroll_position = std::max(0, lyrics_scroll_position - 5);
-                    return;
-                }
-            }
-            case Key::PageDown: {
-                if (current_view == ViewMode::Player && synced_lyrics.empty() && !lyrics_lines.empty()) {
-                    const int visible = 5;  // Match lyrics_lines reservation
-                    int max_scroll = std::max(0, static_cast<int>(lyrics_lines.size()) - visible);
-                    lyrics_scroll_position = std::min(max_scroll, lyrics_scroll_position + 5);
-                    return;
-                }
-            }
+            case Key::Up:
+            case Key::Down:
+            case Key::PageUp:
+            case Key::PageDown:
+            case Key::Home:
+            case Key::End:
                 {
-                    int max_idx = -1;
-                    if (browse_mode == BrowseMode::Artists) {
-                        max_idx = static_cast<int>(artists.size()) - 1;
-                    } else if (browse_mode == BrowseMode::Albums) {
-                        max_idx = static_cast<int>(albums.size()) - 1;
-                    } else if (browse_mode == BrowseMode::Playlists) {
-                        max_idx = static_cast<int>(playlists.size()) - 1;
-                    } else if (browse_mode == BrowseMode::Tracks) {
-                        max_idx = static_cast<int>(browse_tracks.size()) - 1;
-                    }
+                    // A row, a screenful, or to either end: the browse list
+                    // fetches whatever comes into view
+                    int last = browse_item_count() - 1;
+                    int max_items = std::max(1, term.height() - 6 - 3);
+                    int target = selected_index;
+                    if (event.key == Key::Up) target -= 1;
+                    else if (event.key == Key::Down) target += 1;
+                    else if (event.key == Key::PageDown) target += max_items;
+                    else if (event.key == Key::PageUp) target -= max_items;
+                    else if (event.key == Key::Home) target = 0;
+                    else if (event.key == Key::End) target = last;
+                    target = std::clamp(target, 0, std::max(0, last));
                     
-                    if (max_idx >= 0 && selected_index < max_idx) {
+                    if (last >= 0 && target != selected_index) {
                         int old_index = selected_index;
-                        selected_index++;
+                        selected_index = target;
                         // Clear album art when changing selection to prevent stale data
                         if (browse_mode == BrowseMode::Albums && old_index != selected_index && album_art_for_albums) {
                             album_art_for_albums->clear();
                         }
                         // Update scroll offset to keep selection visible
-                        int h = term.height();
-                        int max_items = std::max(1, h - 6 - 3);
                         if (selected_index >= scroll_offset + max_items) {
                             scroll_offset = selected_index - max_items + 1;
+                        } else if (selected_index < scroll_offset) {
+                            scroll_offset = selected_index;
                         }
                     }
                 }
@@ -1522,26 +1666,19 @@ void PlayerView::handle_input(const InputEvent& event) {
                     selected_index = 0;
                     scroll_offset = 0;
                     browse_tracks.clear();  // Clear tracks when going back
-                    // Clear pagination state
                     current_playlist_id.clear();
-                    playlist_total_size = 0;
-                    playlist_loaded_count = 0;
                     is_search_mode = false;
                     current_search_query.clear();
-                    search_loaded_count = 0;
                     // Clear album info when going back
                     current_album_id.clear();
                     current_album = PlexClient::Album();
                     album_art_for_tracks.reset();
                 } else {
                     current_view = ViewMode::Player;
-                    // Clear pagination state when leaving tracks view
+                    // Leaving the library: forget which playlist / search was listed
                     current_playlist_id.clear();
-                    playlist_total_size = 0;
-                    playlist_loaded_count = 0;
                     is_search_mode = false;
                     current_search_query.clear();
-                    search_loaded_count = 0;
                     // Clear album info when leaving library view
                     current_album_id.clear();
                     current_album = PlexClient::Album();
@@ -1562,9 +1699,11 @@ void PlayerView::handle_input(const InputEvent& event) {
                     selected_index = 0;
                     scroll_offset = 0;
                     // Ensure playlists are loaded
-                    if (playlists.empty() && music_library_id > 0) {
+                    if (!playlists.attached() && music_library_id > 0) {
                         load_library_data();
                     }
+                } else if (event.character == 'S' && browse_mode == BrowseMode::Tracks) {
+                    shuffle_play();
                 } else if (event.character == 'l' || event.character == 'L') {
                     current_view = ViewMode::Library;
                     search_active = false;
@@ -1588,13 +1727,9 @@ void PlayerView::handle_input(const InputEvent& event) {
                     // When deactivating search, clear query if empty
                     if (search_query.empty()) {
                         browse_tracks.clear();
-                        // Clear search/playlist pagination
                         is_search_mode = false;
                         current_search_query.clear();
-                        search_loaded_count = 0;
                         current_playlist_id.clear();
-                        playlist_total_size = 0;
-                        playlist_loaded_count = 0;
                     }
                 }
                 break;
@@ -1795,15 +1930,13 @@ void PlayerView::handle_mouse_event(const MouseEvent& event) {
             // Account for scrolling
             int actual_idx = clicked_playlist_idx + playlist_scroll_offset;
             
-            if (clicked_playlist_idx >= 0 && 
-                actual_idx >= 0 &&
-                actual_idx < static_cast<int>(playlists.size())) {
+            if (clicked_playlist_idx >= 0 && sidebar_playlists.loaded(actual_idx)) {
                 // Clicked on a playlist - select it and load tracks
                 selected_index = actual_idx;
                 current_view = ViewMode::Library;
                 browse_mode = BrowseMode::Playlists;  // Set to Playlists mode first
                 scroll_offset = 0;  // Reset scroll
-                select_item();  // This will load the tracks and switch to Tracks mode
+                open_playlist(sidebar_playlists[actual_idx]);  // Switches to Tracks mode when they arrive
                 return;
             }
         }
@@ -1840,12 +1973,10 @@ void PlayerView::handle_mouse_event(const MouseEvent& event) {
             current_album_id.clear();
             album_art_for_tracks.reset();
             // Ensure playlists are loaded
-            if (playlists.empty() && music_library_id > 0) {
-                try {
-                    playlists = client.get_playlists(100);
-                } catch (...) {
-                    // Failed to load playlists
-                }
+            if (!playlists.attached() && music_library_id > 0) {
+                playlists.reset(page_source<PlexClient::Playlist>([this](int start, int count, auto done) {
+                    return client.get_playlists_async(start, count, std::move(done));
+                }));
             }
             return;
         } else if (x >= menu_x + 32 && x < menu_x + 40) {
@@ -1946,10 +2077,10 @@ std::string PlayerView::format_time(uint32_t milliseconds) {
     uint32_t minutes = seconds / 60;
     seconds = seconds % 60;
     
-    std::stringstream ss;
-    ss << std::setfill('0') << std::setw(2) << minutes << ":"
-       << std::setfill('0') << std::setw(2) << seconds;
-    return ss.str();
+    // Short enough for the small-string buffer - no heap allocation per call
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%02u:%02u", minutes, seconds);
+    return std::string(buf);
 }
 
 std::string PlayerView::format_volume(float volume) {
@@ -1960,42 +2091,51 @@ std::string PlayerView::format_volume(float volume) {
 void PlayerView::load_library_data() {
     if (music_library_id < 0) return;
     if (!client.is_connected()) return;
-    
-    try {
-        artists = client.get_artists(music_library_id, 100);
-        albums = client.get_albums(music_library_id, "", 100);
-        playlists = client.get_playlists(50);
-    } catch (...) {
-        // Library loading failed - continue without it
-        artists.clear();
-        albums.clear();
-        playlists.clear();
-    }
+    library_index_version = client.get_library_index_version();
+    
+    // All of them load concurrently, a page at a time (artists and albums straight
+    // from the local library when synced); a failed request just leaves its list empty
+    int library_id = music_library_id;
+    artists.reset(page_source<PlexClient::Artist>([this, library_id](int start, int count, auto done) {
+        return client.get_artists_async(library_id, start, count, std::move(done));
+    }));
+    albums.reset(page_source<PlexClient::Album>([this, library_id](int start, int count, auto done) {
+        return client.get_albums_async(library_id, "", start, count, std::move(done));
+    }));
+    auto playlist_pages = page_source<PlexClient::Playlist>([this](int start, int count, auto done) {
+        return client.get_playlists_async(start, count, std::move(done));
+    });
+    playlists.reset(playlist_pages);
+    sidebar_playlists.reset(playlist_pages);
+}
+
+uint64_t PlayerView::begin_browse_request() {
+    client.cancel_request(browse_request_id);
+    browse_request_id = 0;
+    return ++browse_generation;
 }
 
 void PlayerView::perform_search() {
     if (search_query.empty()) {
         browse_tracks.clear();
-        // Clear pagination state when clearing search
+        // Clear playlist / search state when clearing search
         current_playlist_id.clear();
-        playlist_total_size = 0;
-        playlist_loaded_count = 0;
         is_search_mode = false;
         current_search_query.clear();
-        search_loaded_count = 0;
+        client.cancel_request(search_request_id);
+        search_request_id = 0;
         return;
     }
     
     // Minimum 2 characters before searching (reduces API calls)
     if (search_query.length() < 2) {
         browse_tracks.clear();
-        // Clear pagination state when clearing search
+        // Clear playlist / search state when clearing search
         current_playlist_id.clear();
-        playlist_total_size = 0;
-        playlist_loaded_count = 0;
         is_search_mode = false;
         current_search_query.clear();
-        search_loaded_count = 0;
+        client.cancel_request(search_request_id);
+        search_request_id = 0;
         return;
     }
     
@@ -2003,171 +2143,63 @@ void PlayerView::perform_search() {
     bool is_new_search = (current_search_query != search_query);
     
     if (is_new_search) {
-        // New search - reset everything
+        // New search - reset everything, dropping the old query's pages
         browse_tracks.clear();
         current_playlist_id.clear();
-        playlist_total_size = 0;
-        playlist_loaded_count = 0;
-        search_loaded_count = 0;
         current_search_query = search_query;
         if (config.enable_debug_logging) {
             std::cerr << "[LOG] New search: \"" << search_query << "\"" << std::endl;
         }
-    } else {
-        // Same search query - don't search again if we already have results
-        // Only search again when user scrolls to load more (handled elsewhere)
-        if (search_loaded_count > 0 && !browse_tracks.empty()) {
-            // Already have results for this query, don't search again
-            if (config.enable_debug_logging) {
-                std::cerr << "[LOG] Search skipped: already have " << browse_tracks.size() << " results for \"" << search_query << "\"" << std::endl;
-            }
-            return;
-        }
+    } else if (is_search_mode && browse_tracks.attached()) {
+        // Same search query - already listed; browse_tracks pages through the rest
         if (config.enable_debug_logging) {
-            std::cerr << "[LOG] Continuing search: \"" << search_query << "\" (loaded: " << search_loaded_count << ")" << std::endl;
+            std::cerr << "[LOG] Search skipped: already listing " << browse_tracks.size() << " results for \"" << search_query << "\"" << std::endl;
         }
+        return;
     }
     
-    // Perform server-side search via Plex API - load first chunk only
-    std::vector<Track> search_results = client.search_tracks(search_query, SEARCH_CHUNK_SIZE, search_loaded_count);
-    if (config.enable_debug_logging) {
-        std::cerr << "[LOG] Search API returned " << search_results.size() << " results for \"" << search_query << "\"" << std::endl;
-    }
-    
-    // Always deduplicate search results (Plex API may return duplicates)
-    // Use both ID-based and content-based (title+artist+album) deduplication
-    // Normalize signatures to handle case/whitespace differences
-    auto normalize_signature = [](const std::string& title, const std::string& artist, const std::string& album) -> std::string {
-        // Convert to lowercase and trim whitespace for comparison
-        std::string sig = title + "|" + artist + "|" + album;
-        std::transform(sig.begin(), sig.end(), sig.begin(), ::tolower);
-        // Remove extra whitespace
-        sig.erase(std::remove_if(sig.begin(), sig.end(), [](char c) { return std::isspace(c); }), sig.end());
-        return sig;
-    };
-    
-    std::set<std::string> seen_ids;
-    std::set<std::string> seen_signatures;  // normalized title|artist|album for fallback deduplication
-    std::vector<Track> deduplicated_results;
-    
-    int duplicates_found = 0;
-    int duplicates_by_id = 0;
-    int duplicates_by_signature = 0;
-    
-    for (const auto& track : search_results) {
-        bool is_duplicate = false;
-        
-        // First check by ID (most reliable)
-        if (!track.id.empty()) {
-            if (seen_ids.find(track.id) != seen_ids.end()) {
-                is_duplicate = true;
-                duplicates_found++;
-                duplicates_by_id++;
-            } else {
-                seen_ids.insert(track.id);
-            }
-        }
-        
-        // Fallback: check by normalized content signature (title|artist|album)
-        if (!is_duplicate) {
-            std::string signature = normalize_signature(track.title, track.artist, track.album);
-            if (seen_signatures.find(signature) != seen_signatures.end()) {
-                is_duplicate = true;
-                duplicates_found++;
-                duplicates_by_signature++;
-            } else {
-                seen_signatures.insert(signature);
-            }
-        }
-        
-        if (!is_duplicate) {
-            deduplicated_results.push_back(track);
+    // Perform server-side search via Plex API - first page only. The request
+    // runs in the background; a newer query cancels it and its results are dropped.
+    if (search_request_id != 0) {
+        if (!is_new_search) {
+            return;  // This query's results are already on their way
         }
+        client.cancel_request(search_request_id);
     }
-    
-    // Log detailed deduplication info (only if debug logging enabled)
-    if (config.enable_debug_logging && duplicates_found > 0) {
-        std::cerr << "[LOG] Deduplication details: " << duplicates_by_id << " by ID, " << duplicates_by_signature << " by signature" << std::endl;
-    }
-    
-    // Log deduplication results (only if debug logging enabled)
-    if (config.enable_debug_logging) {
-        if (duplicates_found > 0) {
-            std::cerr << "[LOG] Search deduplication: Found " << duplicates_found << " duplicates out of " << search_results.size() << " results" << std::endl;
-        } else if (search_results.size() > 0) {
-            std::cerr << "[LOG] Search deduplication: " << search_results.size() << " results, no duplicates found" << std::endl;
+    if (music_library_id < 0) {
+        music_library_id = client.get_music_library_id();
+        if (music_library_id < 0) {
+            apply_search_results({});
+            return;
         }
     }
-    
-    if (is_new_search) {
-        // New search - replace results
-        browse_tracks = deduplicated_results;
-        search_loaded_count = static_cast<int>(deduplicated_results.size());
-        if (config.enable_debug_logging) {
-            std::cerr << "[LOG] New search complete: " << search_results.size() << " API results -> " 
-                      << duplicates_found << " duplicates removed -> " << deduplicated_results.size() 
-                      << " unique tracks (browse_tracks.size()=" << browse_tracks.size() << ")" << std::endl;
-        }
-    } else {
-        // Continuing search - append results with additional deduplication against existing
-        // Build sets of existing track IDs and signatures for fast lookup
-        std::set<std::string> existing_ids;
-        std::set<std::string> existing_signatures;
-        for (const auto& track : browse_tracks) {
-            if (!track.id.empty()) {
-                existing_ids.insert(track.id);
-            }
-            std::string sig = normalize_signature(track.title, track.artist, track.album);
-            existing_signatures.insert(sig);
-        }
-        
-        if (config.enable_debug_logging) {
-            std::cerr << "[LOG] Before pagination: browse_tracks.size()=" << browse_tracks.size() 
-                      << ", existing_ids.size()=" << existing_ids.size() 
-                      << ", existing_signatures.size()=" << existing_signatures.size() << std::endl;
-        }
-        
-        // Only add tracks that aren't already in the list (check both ID and signature)
-        int added_count = 0;
-        int skipped_duplicates = 0;
-        for (const auto& track : deduplicated_results) {
-            bool exists = false;
-            
-            // Check by ID first (most reliable)
-            if (!track.id.empty() && existing_ids.find(track.id) != existing_ids.end()) {
-                exists = true;
-                skipped_duplicates++;
-            }
-            
-            // Check by normalized signature (fallback for tracks without IDs)
-            if (!exists) {
-                std::string sig = normalize_signature(track.title, track.artist, track.album);
-                if (existing_signatures.find(sig) != existing_signatures.end()) {
-                    exists = true;
-                    skipped_duplicates++;
-                }
-            }
-            
-            if (!exists) {
-                browse_tracks.push_back(track);
-                if (!track.id.empty()) {
-                    existing_ids.insert(track.id);
-                }
-                std::string sig = normalize_signature(track.title, track.artist, track.album);
-                existing_signatures.insert(sig);
-                added_count++;
+    std::string query = search_query;
+    search_request_id = client.search_tracks_async(music_library_id, query, 0, BROWSE_PAGE_SIZE,
+        [this, query](PlexClient::Page<Track> first_page) {
+            if (query != current_search_query) return;  // Superseded by a newer query
+            search_request_id = 0;
+            if (!first_page.ok) {
+                status_message = "Search failed";
+                return;
             }
-        }
-        search_loaded_count += added_count;
-        // Log pagination deduplication results (only if debug logging enabled)
-        if (config.enable_debug_logging) {
-            std::cerr << "[LOG] Search pagination: " << search_results.size() << " API results -> " 
-                      << duplicates_found << " duplicates in batch -> " << deduplicated_results.size() 
-                      << " deduplicated -> " << skipped_duplicates << " existing skipped -> " 
-                      << added_count << " new tracks added (total: " << browse_tracks.size() << ")" << std::endl;
-        }
+            apply_search_results(std::move(first_page));
+        });
+}
+
+void PlayerView::apply_search_results(PlexClient::Page<Track> first_page) {
+    if (config.enable_debug_logging) {
+        std::cerr << "[LOG] Search API returned " << first_page.items.size() << " of "
+                  << first_page.total << " results for \"" << current_search_query << "\"" << std::endl;
     }
     
+    // Later pages are fetched by position as the list scrolls (X-Plex-Container-Start /
+    // -Size, which don't overlap the way limit + offset did)
+    int library_id = music_library_id;
+    std::string query = current_search_query;
+    browse_tracks.reset(page_source<Track>([this, library_id, query](int start, int count, auto done) {
+        return client.search_tracks_async(library_id, query, start, count, std::move(done));
+    }), std::move(first_page.items), first_page.total);
+    
     is_search_mode = true;
     browse_mode = BrowseMode::Tracks;
     selected_index = 0;
@@ -2215,16 +2247,24 @@ void PlayerView::start_play_with_lyrics(const Track& track) {
 }
 
 void PlayerView::advance_to_next_track() {
-    if (browse_mode != BrowseMode::Tracks || browse_tracks.empty()) return;
-    int current_idx = -1;
-    for (size_t i = 0; i < browse_tracks.size(); ++i) {
-        if (browse_tracks[i].id == playback_state.current_track.id) {
-            current_idx = static_cast<int>(i);
-            break;
+    if (!shuffle_queue.empty()) {
+        if (++shuffle_position < shuffle_queue.size()) {
+            start_play_with_lyrics(shuffle_queue[shuffle_position]);
+        } else {
+            shuffle_queue.clear();
+            client.stop();
+            status_message = "Shuffle finished";
         }
+        return;
     }
-    if (current_idx >= 0 && current_idx + 1 < static_cast<int>(browse_tracks.size())) {
+    if (browse_mode != BrowseMode::Tracks || browse_tracks.empty()) return;
+    // The playing track's row, held with the next one since it started (-1 once
+    // the list shows something else)
+    int current_idx = browse_tracks.held();
+    if (current_idx >= 0 && current_idx + 1 < browse_tracks.size()) {
+        if (!browse_tracks.loaded(current_idx + 1)) return;  // Its page is still on the way
         selected_index = current_idx + 1;
+        browse_tracks.hold(selected_index, 2);
         Track next_track = browse_tracks[selected_index];
         start_play_with_lyrics(next_track);
     } else {
@@ -2234,28 +2274,32 @@ void PlayerView::advance_to_next_track() {
 }
 
 void PlayerView::select_item() {
-    if (browse_mode == BrowseMode::Artists && selected_index >= 0 && selected_index < static_cast<int>(artists.size())) {
-        // Load albums for selected artist
-        try {
-            albums = client.get_albums(music_library_id, artists[selected_index].id, 100);
-            browse_mode = BrowseMode::Albums;
-            selected_index = 0;
-            scroll_offset = 0;
-            status_message = "Loaded " + std::to_string(albums.size()) + " albums";
-        } catch (...) {
-            status_message = "Failed to load albums";
-        }
-    } else if (browse_mode == BrowseMode::Albums && selected_index >= 0 && selected_index < static_cast<int>(albums.size())) {
+    if (browse_mode == BrowseMode::Artists && artists.loaded(selected_index)) {
+        // Load albums for selected artist (switches view when the first page arrives)
+        uint64_t generation = begin_browse_request();
+        status_message = "Loading albums…";
+        int library_id = music_library_id;
+        std::string artist_id = artists[selected_index].id;
+        browse_request_id = client.get_albums_async(library_id, artist_id, 0, BROWSE_PAGE_SIZE,
+            [this, generation, library_id, artist_id](PlexClient::Page<PlexClient::Album> first_page) {
+                if (generation != browse_generation || browse_mode != BrowseMode::Artists) return;
+                browse_request_id = 0;
+                if (!first_page.ok) {
+                    status_message = "Failed to load albums";
+                    return;
+                }
+                albums.reset(page_source<PlexClient::Album>([this, library_id, artist_id](int start, int count, auto done) {
+                    return client.get_albums_async(library_id, artist_id, start, count, std::move(done));
+                }), std::move(first_page.items), first_page.total);
+                browse_mode = BrowseMode::Albums;
+                selected_index = 0;
+                scroll_offset = 0;
+                status_message = "Loaded " + std::to_string(albums.size()) + " albums";
+            });
+    } else if (browse_mode == BrowseMode::Albums && albums.loaded(selected_index)) {
         // Load tracks for selected album (real data from Plex)
         try {
             // Store album info for displaying album art and info
-            // Double-check bounds before accessing - validate albums vector first
-            if (albums.empty() || selected_index < 0 || selected_index >= static_cast<int>(albums.size())) {
-                status_message = "Error: Invalid album selection";
-                return;
-            }
-            
-            // Store album data locally to avoid multiple vector accesses
             const auto selected_album = albums[selected_index];
             std::string album_id_copy = selected_album.id;  // Make a copy before any operations
             
@@ -2274,83 +2318,44 @@ void PlayerView::select_item() {
                 }
             }
             
-            // Load tracks into a temporary vector first to avoid partial state
-            std::vector<Track> new_tracks;
-            try {
-                new_tracks = client.get_album_tracks(album_id_copy);
-            } catch (const std::exception& e) {
-                status_message = "Failed to load tracks: " + std::string(e.what());
-                return;
-            } catch (...) {
-                status_message = "Failed to load tracks (unknown error)";
-                return;
-            }
-            
-            // Only update state if track loading succeeded
-            // Update all state atomically to prevent partial state during drawing
-            browse_tracks = std::move(new_tracks);  // Move instead of copy
-            album_art_for_tracks.reset();  // Clear old art to force reload
-            
-            // Set album info AFTER tracks are loaded
-            current_album = selected_album;
-            current_album_id = album_id_copy;
-            
-            // Clear search/playlist pagination when loading album
-            is_search_mode = false;
-            current_search_query.clear();
-            search_loaded_count = 0;
-            current_playlist_id.clear();
-            playlist_total_size = 0;
-            playlist_loaded_count = 0;
-            
-            // Switch mode LAST to ensure all state is ready
-            browse_mode = BrowseMode::Tracks;
-            selected_index = 0;
-            scroll_offset = 0;
-            status_message = "Loaded " + std::to_string(browse_tracks.size()) + " tracks";
+            // Load tracks in the background; state switches over in one step when they arrive
+            uint64_t generation = begin_browse_request();
+            status_message = "Loading tracks…";
+            browse_request_id = client.get_album_tracks_async(album_id_copy,
+                [this, generation, selected_album, album_id_copy](std::vector<Track> new_tracks) {
+                    if (generation != browse_generation || browse_mode != BrowseMode::Albums) return;
+                    browse_request_id = 0;
+                    
+                    // Update all state atomically to prevent partial state during drawing
+                    browse_tracks.assign(std::move(new_tracks));  // An album's tracks come in one response
+                    album_art_for_tracks.reset();  // Clear old art to force reload
+                    
+                    // Set album info AFTER tracks are loaded
+                    current_album = selected_album;
+                    current_album_id = album_id_copy;
+                    
+                    // No longer listing a search or playlist
+                    is_search_mode = false;
+                    current_search_query.clear();
+                    current_playlist_id.clear();
+                    
+                    // Switch mode LAST to ensure all state is ready
+                    browse_mode = BrowseMode::Tracks;
+                    selected_index = 0;
+                    scroll_offset = 0;
+                    status_message = "Loaded " + std::to_string(browse_tracks.size()) + " tracks";
+                });
         } catch (const std::exception& e) {
             status_message = "Failed to load tracks: " + std::string(e.what());
-            current_album_id.clear();
-            current_album = PlexClient::Album();
-            browse_tracks.clear();
         } catch (...) {
             status_message = "Failed to load tracks (unknown error)";
-            current_album_id.clear();
-            current_album = PlexClient::Album();
-            browse_tracks.clear();
         }
-    } else if (browse_mode == BrowseMode::Playlists && selected_index >= 0 && selected_index < static_cast<int>(playlists.size())) {
-        // Load tracks for selected playlist (real data from Plex) - with pagination
-        try {
-            current_playlist_id = playlists[selected_index].id;
-            playlist_loaded_count = 0;
-            playlist_total_size = playlists[selected_index].count;  // Use playlist count if available
-            
-            // Load first chunk only (lazy loading)
-            browse_tracks = client.get_playlist_tracks(current_playlist_id, 0, PLAYLIST_CHUNK_SIZE);
-            playlist_loaded_count = static_cast<int>(browse_tracks.size());
-            
-            browse_mode = BrowseMode::Tracks;  // Switch to tracks view
-            selected_index = 0;
-            scroll_offset = 0;
-            // Clear search pagination when loading playlist
-            is_search_mode = false;
-            current_search_query.clear();
-            search_loaded_count = 0;
-            // Keep track of which playlist we're viewing (for going back)
-            if (playlist_total_size > 0) {
-                status_message = "Loaded " + std::to_string(playlist_loaded_count) + " of " + 
-                                std::to_string(playlist_total_size) + " tracks (scroll to load more)";
-            } else {
-                status_message = "Loaded " + std::to_string(playlist_loaded_count) + " tracks from playlist";
-            }
-        } catch (...) {
-            status_message = "Failed to load playlist tracks";
-            // On error, go back to Playlists view so user can try another
-            browse_mode = BrowseMode::Playlists;
-            current_playlist_id.clear();
-        }
-    } else if (browse_mode == BrowseMode::Tracks && selected_index >= 0 && selected_index < static_cast<int>(browse_tracks.size())) {
+    } else if (browse_mode == BrowseMode::Playlists && playlists.loaded(selected_index)) {
+        open_playlist(playlists[selected_index]);
+    } else if (browse_mode == BrowseMode::Tracks && browse_tracks.loaded(selected_index)) {
+        shuffle_queue.clear();  // Picking a track plays the list in order from there
+        client.cancel_bulk_load();
+        browse_tracks.hold(selected_index, 2);  // Auto-advance plays the next row, wherever the list scrolls
         const Track& track = browse_tracks[selected_index];
         current_view = ViewMode::Player;
         try {
@@ -2365,6 +2370,84 @@ void PlayerView::select_item() {
     }
 }
 
+void PlayerView::shuffle_play() {
+    if (browse_mode != BrowseMode::Tracks || browse_tracks.empty()) return;
+    if (!current_playlist_id.empty()) {
+        // Only the pages around the screen are loaded: download the rest, in parallel
+        auto tracks = std::make_shared<std::vector<Track>>();
+        int total = browse_tracks.size();
+        status_message = "Loading playlist for shuffle…";
+        client.load_playlist_tracks_async(current_playlist_id, total,
+            [this, tracks, total](PlexClient::Page<Track> page) {
+                tracks->insert(tracks->end(), std::make_move_iterator(page.items.begin()),
+                               std::make_move_iterator(page.items.end()));
+                status_message = "Loading playlist for shuffle… " + std::to_string(tracks->size()) + " of " +
+                                 std::to_string(page.total >= 0 ? page.total : total) + " tracks";
+            },
+            [this, tracks](bool ok) {
+                if (!ok || tracks->empty()) {
+                    status_message = "Failed to load playlist for shuffle";
+                    return;
+                }
+                start_shuffle(std::move(*tracks));
+            });
+        return;
+    }
+    
+    // An album's tracks are all here; search results only once every page has been seen
+    std::vector<Track> tracks;
+    tracks.reserve(static_cast<size_t>(browse_tracks.size()));
+    for (int i = 0; i < browse_tracks.size(); ++i) {
+        if (!browse_tracks.loaded(i)) {
+            status_message = "Shuffle needs the whole list: open an album or playlist";
+            return;
+        }
+        tracks.push_back(browse_tracks[i]);
+    }
+    start_shuffle(std::move(tracks));
+}
+
+void PlayerView::start_shuffle(std::vector<Track> tracks) {
+    static std::mt19937 rng{std::random_device{}()};
+    std::shuffle(tracks.begin(), tracks.end(), rng);
+    shuffle_queue = std::move(tracks);
+    shuffle_position = 0;
+    browse_tracks.hold(-1, 0);  // The list's own order no longer drives auto-advance
+    current_view = ViewMode::Player;
+    start_play_with_lyrics(shuffle_queue[0]);
+    status_message = "Shuffling " + std::to_string(shuffle_queue.size()) + " tracks";
+}
+
+void PlayerView::open_playlist(const PlexClient::Playlist& playlist) {
+    // Tracks come a page at a time as the list scrolls; switch views with the first one
+    uint64_t generation = begin_browse_request();
+    status_message = "Loading playlist…";
+    std::string playlist_id = playlist.id;
+    int playlist_count = playlist.count;  // leafCount, for servers that leave out totalSize
+    browse_request_id = client.get_playlist_tracks_async(playlist_id, 0, BROWSE_PAGE_SIZE,
+        [this, generation, playlist_id, playlist_count](PlexClient::Page<Track> first_page) {
+            if (generation != browse_generation || browse_mode != BrowseMode::Playlists) return;
+            browse_request_id = 0;
+            if (!first_page.ok) {
+                status_message = "Failed to load playlist";
+                return;
+            }
+            current_playlist_id = playlist_id;
+            browse_tracks.reset(page_source<Track>([this, playlist_id](int start, int count, auto done) {
+                return client.get_playlist_tracks_async(playlist_id, start, count, std::move(done));
+            }), std::move(first_page.items),
+               first_page.total >= 0 || playlist_count <= 0 ? first_page.total : playlist_count);
+            
+            browse_mode = BrowseMode::Tracks;  // Switch to tracks view
+            selected_index = 0;
+            scroll_offset = 0;
+            // No longer listing a search
+            is_search_mode = false;
+            current_search_query.clear();
+            status_message = "Loaded playlist (" + std::to_string(browse_tracks.size()) + " tracks)";
+        });
+}
+
 void PlayerView::draw_library_view(const Layout& layout) {
     int sidebar_w = 30;
     int w = term.width();
@@ -2373,13 +2456,11 @@ void PlayerView::draw_library_view(const Layout& layout) {
     if (h <= 0) h = 24;  // Safety check
     
     // Clear main content area to remove fragments (btop-style: full clear on view change)
-    std::string black_bg = term.bg_color(0, 0, 0);
     int main_w = w - sidebar_w;
     if (main_w > 0 && main_w <= 1000) {
         // Fill entire main content area with black to remove all fragments
         for (int y = 0; y < h - 1 && y < 1000; ++y) {  // Don't overwrite status bar
-            std::string line(main_w, ' ');
-            term.draw_text(sidebar_w, y, black_bg + line + term.reset_color());
+            term.fill(sidebar_w, y, main_w);
         }
     }
     
@@ -2390,9 +2471,7 @@ void PlayerView::draw_library_view(const Layout& layout) {
             layout.album_art_x + layout.album_art_w <= w &&
             layout.album_art_y + layout.album_art_h <= h) {
             for (int y = 0; y < layout.album_art_h; ++y) {
-                std::string line(layout.album_art_w, ' ');
-                term.draw_text(layout.album_art_x, layout.album_art_y + y, 
-                              black_bg + line + term.reset_color());
+                term.fill(layout.album_art_x, layout.album_art_y + y, layout.album_art_w);
             }
         }
         // Clear Library view album art position (top-right)
@@ -2401,9 +2480,7 @@ void PlayerView::draw_library_view(const Layout& layout) {
         if (lib_art_x >= sidebar_w && lib_art_x + layout.album_art_w <= w &&
             lib_art_y >= 0 && lib_art_y + layout.album_art_h <= h) {
             for (int y = 0; y < layout.album_art_h; ++y) {
-                std::string line(layout.album_art_w, ' ');
-                term.draw_text(lib_art_x, lib_art_y + y, 
-                              black_bg + line + term.reset_color());
+                term.fill(lib_art_x, lib_art_y + y, layout.album_art_w);
             }
         }
     }
@@ -2419,28 +2496,30 @@ void PlayerView::draw_library_view(const Layout& layout) {
     int menu_x = sidebar_w + 2;
     
     // Bright mode buttons (white when active, dim when not)
-    std::string bright = term.fg_color(255, 255, 255);
-    std::string dim = term.fg_color(150, 150, 150);
-    std::string menu_bg = term.bg_color(0, 0, 0);
+    const Theme::RGB bright{255, 255, 255};
+    const Theme::RGB dim{150, 150, 150};
     
-    std::string artists_color = (browse_mode == BrowseMode::Artists) ? bright : dim;
-    std::string albums_color = (browse_mode == BrowseMode::Albums) ? bright : dim;
-    std::string playlists_color = (browse_mode == BrowseMode::Playlists) ? bright : dim;
-    std::string tracks_color = (browse_mode == BrowseMode::Tracks) ? bright : dim;
-    
-    term.draw_text(menu_x, y, menu_bg + artists_color + "Artists" + term.reset_color());
-    term.draw_text(menu_x + 10, y, menu_bg + albums_color + "Albums" + term.reset_color());
-    term.draw_text(menu_x + 20, y, menu_bg + playlists_color + "Playlists" + term.reset_color());
-    term.draw_text(menu_x + 32, y, menu_bg + tracks_color + "Tracks" + term.reset_color());
+    term.print(menu_x, y, (browse_mode == BrowseMode::Artists) ? bright : dim, "Artists");
+    term.print(menu_x + 10, y, (browse_mode == BrowseMode::Albums) ? bright : dim, "Albums");
+    term.print(menu_x + 20, y, (browse_mode == BrowseMode::Playlists) ? bright : dim, "Playlists");
+    term.print(menu_x + 32, y, (browse_mode == BrowseMode::Tracks) ? bright : dim, "Tracks");
     
     // Draw separator (orange equals like player view, btop style)
-    std::string orange_color = term.fg_color(255, 140, 0);  // Plex orange
+    const Theme::RGB orange{255, 140, 0};  // Plex orange
     int sep_width = w - sidebar_w - 4;
     if (sep_width > 0 && sep_width <= 1000) {
-        std::string separator(sep_width, '=');  // Orange equals separator like player view
-        term.draw_text(menu_x, y + 1, menu_bg + orange_color + separator + term.reset_color());
+        // Orange equals separator like player view
+        term.move_cursor(menu_x, y + 1);
+        term.write_bg(0, 0, 0);
+        term.write_fg(orange);
+        term.write_repeat("=", sep_width);
+        term.write_reset();
     }
     
+    draw_browse_list(layout);
+}
+
+void PlayerView::draw_browse_list(const Layout& layout) {
     // Draw list based on mode
     if (browse_mode == BrowseMode::Artists) {
         draw_artists_list(layout);
@@ -2453,6 +2532,99 @@ void PlayerView::draw_library_view(const Layout& layout) {
     }
 }
 
+int PlayerView::browse_item_count() const {
+    switch (browse_mode) {
+        case BrowseMode::Artists: return static_cast<int>(artists.size());
+        case BrowseMode::Albums: return static_cast<int>(albums.size());
+        case BrowseMode::Playlists: return static_cast<int>(playlists.size());
+        default: return static_cast<int>(browse_tracks.size());
+    }
+}
+
+void PlayerView::begin_list_rows(int x, int y, int w, int rows) {
+    rows = std::max(0, rows);
+    if (w <= 0 || w > 1000) {
+        list_update.rows.assign(static_cast<size_t>(rows), 1);  // Nothing to clear or scroll
+        return;
+    }
+    list_update.rows.assign(static_cast<size_t>(rows), list_update.partial ? 0 : 1);
+    if (list_update.partial) {
+        int delta = list_update.scroll_delta;
+        if (delta == 0) {
+            // Selection moved within the window - nothing to scroll
+        } else if (std::abs(delta) < rows && term.scroll_rect(x, y, w, rows, delta)) {
+            // Rows that scrolled into view came in blank
+            int first = delta > 0 ? rows - delta : 0;
+            for (int i = 0; i < std::abs(delta); ++i) {
+                list_update.rows[first + i] = 1;
+            }
+        } else {
+            std::fill(list_update.rows.begin(), list_update.rows.end(), 1);
+        }
+        // Old highlight off, new highlight on
+        for (int idx : {list_update.prev_selected, selected_index}) {
+            int row = idx - scroll_offset;
+            if (row >= 0 && row < rows) {
+                list_update.rows[row] = 1;
+            }
+        }
+    }
+    for (int i = 0; i < rows; ++i) {
+        if (list_update.rows[i]) {
+            term.fill(x, y + i, w);
+        }
+    }
+}
+
+void PlayerView::draw_loading_row(int x, int y, bool selected) {
+    // A row whose page hasn't arrived yet
+    term.print(x, y, config.theme.dimmed, selected ? "> …" : "  …");
+}
+
+void PlayerView::update_library_art() {
+    if (!config.enable_album_art || !client.is_connected()) {
+        artist_art.reset();
+        album_art_for_tracks.reset();
+        return;
+    }
+    
+    // Highest priority first: the selection, then alternating neighbours outward
+    std::vector<ArtLoader::Request> wanted;
+    auto want_around_selection = [&](const auto& items) {
+        int count = static_cast<int>(items.size());
+        auto want = [&](int idx) {
+            if (idx >= 0 && idx < count && !items[idx].art_url.empty()) {
+                wanted.push_back({items[idx].art_url, LIBRARY_ART_W, LIBRARY_ART_H});
+            }
+        };
+        want(selected_index);
+        for (int d = 1; d <= ART_PREFETCH_RADIUS; ++d) {
+            want(selected_index + d);
+            want(selected_index - d);
+        }
+    };
+    
+    bool show_tracks_art = browse_mode == BrowseMode::Tracks && !current_album_id.empty() &&
+                           !is_search_mode && current_playlist_id.empty() && !current_album.art_url.empty();
+    if (browse_mode == BrowseMode::Artists) {
+        want_around_selection(artists);
+    } else if (browse_mode == BrowseMode::Albums) {
+        // Albums show no art themselves: warm the art the album's track list shows
+        want_around_selection(albums);
+    } else if (show_tracks_art) {
+        wanted.push_back({current_album.art_url, LIBRARY_ART_W, LIBRARY_ART_H});
+    }
+    art_loader.request(client.get_server_url(), client.get_token(), wanted);
+    
+    artist_art.reset();
+    if (browse_mode == BrowseMode::Artists && selected_index >= 0 &&
+        selected_index < static_cast<int>(artists.size()) && !artists[selected_index].art_url.empty()) {
+        artist_art = art_loader.get(artists[selected_index].art_url, LIBRARY_ART_W, LIBRARY_ART_H);
+    }
+    album_art_for_tracks = show_tracks_art ? art_loader.get(current_album.art_url, LIBRARY_ART_W, LIBRARY_ART_H)
+                                           : nullptr;
+}
+
 void PlayerView::draw_search_bar(const Layout& /*layout*/) {
     int sidebar_w = 30;
     int w = term.width();
@@ -2462,23 +2634,31 @@ void PlayerView::draw_search_bar(const Layout& /*layout*/) {
     int search_x = sidebar_w + 2;
     int search_y = 2;
     
-    std::string bright_white = term.fg_color(255, 255, 255);
-    std::string dim_white = term.fg_color(180, 180, 180);
-    std::string black_bg = term.bg_color(0, 0, 0);
-    
-    // Search prompt and input (black bg, white text)
-    std::string search_line = "Search: " + search_query;
-    if (search_active) {
-        search_line += "_";  // Cursor when active
-    }
-    
+    // Search prompt and input (black bg, white text), cursor when active
     // Truncate if too long
     int max_search_w = w - search_x - 4;
-    if (static_cast<int>(search_line.length()) > max_search_w) {
-        search_line = search_line.substr(0, max_search_w - 3) + "...";
+    int line_len = 8 + static_cast<int>(search_query.length()) + (search_active ? 1 : 0);
+    
+    term.move_cursor(search_x, search_y);
+    term.write_bg(0, 0, 0);
+    term.write_fg(255, 255, 255);
+    if (line_len > max_search_w) {
+        int keep = std::max(0, max_search_w - 3);
+        std::string_view prompt = "Search: ";
+        std::string_view query = search_query;
+        if (keep <= static_cast<int>(prompt.length())) {
+            term.write(prompt.substr(0, static_cast<size_t>(keep)));
+        } else {
+            term.write(prompt);
+            term.write(query.substr(0, static_cast<size_t>(keep) - prompt.length()));
+        }
+        term.write("...");
+    } else {
+        term.write("Search: ");
+        term.write(search_query);
+        if (search_active) term.write("_");
     }
-    
-    term.draw_text(search_x, search_y, black_bg + bright_white + search_line + term.reset_color());
+    term.write_reset();
 }
 
 void PlayerView::draw_artists_list(const Layout& /*layout*/) {
@@ -2501,51 +2681,24 @@ void PlayerView::draw_artists_list(const Layout& /*layout*/) {
         try {
             const auto& selected_artist = artists[selected_index];
             if (!selected_artist.art_url.empty()) {
-                // Initialize artist art object if needed
-                if (!artist_art) {
-                    artist_art = std::make_unique<AlbumArt>();
-                }
-                
-                // Fetch artist art if not already loaded or if artist changed
-                static std::string last_artist_id;
-                if (last_artist_id != selected_artist.id || !artist_art->has_art()) {
-                    try {
-                        artist_art->fetch_art(
-                            client.get_server_url(),
-                            client.get_token(),
-                            selected_artist.art_url
-                        );
-                    } catch (...) {
-                        // Fetch failed - continue without art
-                    }
-                    last_artist_id = selected_artist.id;
-                }
+                // Small artist pic in top-right (same size as album art); its space
+                // is kept while art_loader is still fetching it
+                artist_art_w = LIBRARY_ART_W;
+                artist_art_h = LIBRARY_ART_H;
             
-            // Draw small artist pic in top-right (same size as album art: 50x25)
-            artist_art_w = 50;
-            artist_art_h = 25;
+            // Draw small artist pic in top-right
             artist_art_x = w - artist_art_w - 2;  // Top-right with 2 char margin
-            has_artist_art = artist_art->has_art();
+            has_artist_art = true;
             
-            if (has_artist_art) {
-                auto art_lines = artist_art->render_pixelated(artist_art_w, artist_art_h, config.theme);
-                for (size_t y = 0; y < art_lines.size() && y < static_cast<size_t>(artist_art_h); ++y) {
-                    if (artist_art_y + static_cast<int>(y) < h && artist_art_x >= 0 && artist_art_x < w) {
-                        term.draw_text(artist_art_x, artist_art_y + static_cast<int>(y), art_lines[y]);
-                    }
-                }
+            if (artist_art && artist_art->has_art() && !list_update.partial) {
+                draw_art_image(*artist_art, artist_art_x, artist_art_y, artist_art_w, artist_art_h);
             }
             
                 // Draw artist name below pic
                 int info_y = artist_art_y + artist_art_h + 1;
-                std::string black_bg = term.bg_color(0, 0, 0);
-                std::string name_color = term.fg_color(255, 255, 255);
-                std::string name = selected_artist.name;
-                if (name.length() > static_cast<size_t>(artist_art_w)) {
-                    name = name.substr(0, artist_art_w - 3) + "...";
-                }
-                if (artist_art_x >= 0 && artist_art_x < w && info_y >= 0 && info_y < h) {
-                    term.draw_text(artist_art_x, info_y, black_bg + name_color + name + term.reset_color());
+                if (!list_update.partial && artist_art_x >= 0 && artist_art_x < w && info_y >= 0 && info_y < h) {
+                    term.print_clipped(artist_art_x, info_y, Theme::RGB(255, 255, 255),
+                                       selected_artist.name, artist_art_w);
                 }
             }
         } catch (...) {
@@ -2563,43 +2716,39 @@ void PlayerView::draw_artists_list(const Layout& /*layout*/) {
     int max_items = std::max(1, h - start_y - 3);
     // Use scroll_offset for proper scrolling
     int visible_start = scroll_offset;
+    artists.show(visible_start, max_items);
     
     // Show message if no artists
     if (artists.empty()) {
-        std::string msg_color = term.fg_color(config.theme.dimmed.r, config.theme.dimmed.g, config.theme.dimmed.b);
-        term.draw_text(list_x, start_y, msg_color + "No artists found. Loading..." + term.reset_color());
+        term.print(list_x, start_y, config.theme.dimmed, "No artists found. Loading...");
         return;
     }
     
     // Clear each line before drawing to remove fragments (btop-style)
     // Only clear the area where artists will be drawn (not artist art area)
-    int clear_width = w - list_x;
+    int clear_width = w - list_x - 1;  // Inside the right border
     if (has_artist_art && artist_art_x < w) {
         // Don't clear over artist art - limit clear width to before artist art
         clear_width = std::min(clear_width, artist_art_x - list_x - 2);
     }
-    if (clear_width > 0 && clear_width <= 1000) {
-        std::string black_bg = term.bg_color(0, 0, 0);
-        std::string clear_line(clear_width, ' ');
-        for (int i = 0; i < max_items; ++i) {
-            term.draw_text(list_x, start_y + i, black_bg + clear_line + term.reset_color());
-        }
-    }
+    begin_list_rows(list_x, start_y, clear_width, max_items);
     
     for (int i = 0; i < max_items && (visible_start + i) < static_cast<int>(artists.size()); ++i) {
+        if (!list_row_dirty(i)) continue;
         int idx = visible_start + i;
         bool selected = (idx == selected_index);
+        if (!artists.loaded(idx)) {
+            draw_loading_row(list_x, start_y + i, selected);
+            continue;
+        }
         
         // Bright text - white when selected, dim when not
-        std::string color = selected ? 
-            term.fg_color(255, 255, 255) : 
-            term.fg_color(200, 200, 200);
-        
-        std::string marker = selected ? "> " : "  ";
-        std::string name = artists[idx].name;
-        if (name.length() > 50) name = name.substr(0, 47) + "...";
-        std::string black_bg = term.bg_color(0, 0, 0);
-        term.draw_text(list_x, start_y + i, black_bg + color + marker + name + term.reset_color());
+        term.move_cursor(list_x, start_y + i);
+        term.write_bg(0, 0, 0);
+        term.write_fg(selected ? Theme::RGB(255, 255, 255) : Theme::RGB(200, 200, 200));
+        term.write(selected ? "> " : "  ");
+        term.write_clipped(artists[idx].name, std::min(50, clear_width - 2));
+        term.write_reset();
     }
 }
 
@@ -2629,7 +2778,8 @@ void PlayerView::draw_albums_list(const Layout& /*layout*/) {
     } else if (config.enable_album_art && selected_index < static_cast<int>(albums.size())) {
         // TEMPORARILY DISABLED: Album art fetching in albums view to debug crash
         // TODO: Re-enable once crash is fixed
-        // When re-enabled, uncomment the code below and use album_art_w, album_art_h, etc.
+        // When re-enabled, take the art from art_loader (see update_library_art) rather
+        // than the synchronous fetch below, and use album_art_w, album_art_h, etc.
         (void)album_art_w;  // Suppress unused variable warning until re-enabled
         (void)album_art_h;
         (void)album_art_x;
@@ -2750,7 +2900,7 @@ void PlayerView::draw_albums_list(const Layout& /*layout*/) {
                             
                             if (has_album_art) {
                                 try {
-                                    auto art_lines = album_art_for_albums->render_pixelated(album_art_w, album_art_h, config.theme);
+                                    const auto& art_lines = album_art_for_albums->render_pixelated(album_art_w, album_art_h, config.theme);
                                     if (!art_lines.empty()) {
                                         for (size_t y = 0; y < art_lines.size() && y < static_cast<size_t>(album_art_h); ++y) {
                                             if (album_art_y + static_cast<int>(y) < h && album_art_x >= 0 && album_art_x < w) {
@@ -2841,63 +2991,71 @@ void PlayerView::draw_albums_list(const Layout& /*layout*/) {
     int max_items = std::max(1, h - start_y - 3);
     // Use scroll_offset for proper scrolling
     int visible_start = scroll_offset;
+    albums.show(visible_start, max_items);
     
     // Show message if no albums
     if (albums.empty()) {
-        std::string msg_color = term.fg_color(config.theme.dimmed.r, config.theme.dimmed.g, config.theme.dimmed.b);
-        term.draw_text(list_x, start_y, msg_color + "No albums found." + term.reset_color());
+        term.print(list_x, start_y, config.theme.dimmed, "No albums found.");
         return;
     }
     
     // Clear each line before drawing to remove fragments (btop-style)
     // Only clear the area where tracks will be drawn (not album art area)
-    int clear_width = w - list_x;
+    int clear_width = w - list_x - 1;  // Inside the right border
     if (has_album_art && album_art_x < w) {
         // Don't clear over album art - limit clear width to before album art
         clear_width = std::min(clear_width, album_art_x - list_x - 2);
     }
-    if (clear_width > 0 && clear_width <= 1000) {
-        std::string black_bg = term.bg_color(0, 0, 0);
-        std::string clear_line(clear_width, ' ');
-        for (int i = 0; i < max_items; ++i) {
-            term.draw_text(list_x, start_y + i, black_bg + clear_line + term.reset_color());
-        }
-    }
+    begin_list_rows(list_x, start_y, clear_width, max_items);
     
     // Validate albums vector before iterating
     if (!albums.empty()) {
         for (int i = 0; i < max_items && (visible_start + i) < static_cast<int>(albums.size()); ++i) {
+            if (!list_row_dirty(i)) continue;
             int idx = visible_start + i;
-            // Double-check bounds before accessing
-            if (idx < 0 || idx >= static_cast<int>(albums.size())) {
-                continue;  // Skip invalid index
+            bool selected = (idx == selected_index);
+            if (!albums.loaded(idx)) {
+                draw_loading_row(list_x, start_y + i, selected);
+                continue;
             }
-            
-            // Store album data locally to avoid multiple vector accesses
             const auto& album = albums[idx];
-            bool selected = (idx == selected_index);
             
             // Bright text - white when selected, dim when not
-            std::string color = selected ? 
-                term.fg_color(255, 255, 255) : 
-                term.fg_color(200, 200, 200);
+            const Theme::RGB dim_color{150, 150, 150};
             
-            std::string dim_color = term.fg_color(150, 150, 150);
-            std::string marker = selected ? "> " : "  ";
+            // Rows stay inside the list rect (it may be hardware-scrolled)
+            int room = clear_width - 2;
+            auto put = [&](std::string_view text) {
+                size_t n = std::min(text.length(), static_cast<size_t>(std::max(0, room)));
+                term.write(text.substr(0, n));
+                room -= static_cast<int>(n);
+            };
             
-            std::string title = album.title;
-            if (title.length() > 35) title = title.substr(0, 32) + "...";
-            
-            std::string black_bg = term.bg_color(0, 0, 0);
-            std::string line = black_bg + color + marker + title;
+            term.move_cursor(list_x, start_y + i);
+            term.write_bg(0, 0, 0);
+            term.write_fg(selected ? Theme::RGB(255, 255, 255) : Theme::RGB(200, 200, 200));
+            term.write(selected ? "> " : "  ");
+            int title_len = std::min(static_cast<int>(album.title.length()), 35);
+            term.write_clipped(album.title, std::min(35, room));
+            room -= std::min(title_len, room);
             if (!album.artist.empty()) {
-                line += black_bg + dim_color + " • " + album.artist + term.reset_color();
+                term.write_bg(0, 0, 0);
+                term.write_fg(dim_color);
+                put(" • ");
+                put(album.artist);
+                term.write_reset();
             }
             if (album.year > 0) {
-                line += black_bg + dim_color + " (" + std::to_string(album.year) + ")" + term.reset_color();
+                char year[8];
+                int len = std::snprintf(year, sizeof(year), "%d", album.year);
+                term.write_bg(0, 0, 0);
+                term.write_fg(dim_color);
+                put(" (");
+                put(std::string_view(year, static_cast<size_t>(std::max(0, len))));
+                put(")");
+                term.write_reset();
             }
-            
-            term.draw_text(list_x, start_y + i, line + term.reset_color());
+            term.write_reset();
         }
     }
 }
@@ -2912,43 +3070,46 @@ void PlayerView::draw_playlists_list(const Layout& /*layout*/) {
     // Use scroll_offset for proper scrolling
     int visible_start = scroll_offset;
     int list_x = sidebar_w + 2;
+    playlists.show(visible_start, max_items);
     
     // Show message if no playlists
     if (playlists.empty()) {
-        std::string msg_color = term.fg_color(config.theme.dimmed.r, config.theme.dimmed.g, config.theme.dimmed.b);
-        term.draw_text(list_x, start_y, msg_color + "No playlists found. Loading..." + term.reset_color());
+        term.print(list_x, start_y, config.theme.dimmed, "No playlists found. Loading...");
         return;
     }
     
     // Clear each line before drawing to remove fragments (btop-style)
     int w = term.width();
-    int clear_width = w - list_x;
-    if (clear_width > 0 && clear_width <= 1000) {
-        std::string black_bg = term.bg_color(0, 0, 0);
-        std::string clear_line(clear_width, ' ');
-        for (int i = 0; i < max_items; ++i) {
-            term.draw_text(list_x, start_y + i, black_bg + clear_line + term.reset_color());
-        }
-    }
+    int clear_width = w - list_x - 1;  // Inside the right border
+    begin_list_rows(list_x, start_y, clear_width, max_items);
     
     for (int i = 0; i < max_items && (visible_start + i) < static_cast<int>(playlists.size()); ++i) {
+        if (!list_row_dirty(i)) continue;
         int idx = visible_start + i;
         bool selected = (idx == selected_index);
+        if (!playlists.loaded(idx)) {
+            draw_loading_row(list_x, start_y + i, selected);
+            continue;
+        }
         
-        // Bright text - white when selected, dim when not
-        std::string color = selected ? 
-            term.fg_color(255, 255, 255) : 
-            term.fg_color(200, 200, 200);
-        
-        std::string count_color = term.fg_color(150, 150, 150);
-        std::string marker = selected ? "> " : "  ";
-        std::string count_str = count_color + " [" + std::to_string(playlists[idx].count) + "]" + term.reset_color();
-        
-        std::string title = playlists[idx].title;
-        if (title.length() > 40) title = title.substr(0, 37) + "...";
+        // "> title  [count]", kept inside the list rect (it may be hardware-scrolled)
+        char count[24];
+        int count_len = std::snprintf(count, sizeof(count), "  [%d]", playlists[idx].count);
+        int title_room = std::min(40, clear_width - 2 - count_len);
         
-        std::string black_bg = term.bg_color(0, 0, 0);
-        term.draw_text(list_x, start_y + i, black_bg + color + marker + title + " " + count_str + term.reset_color());
+        // Bright text - white when selected, dim when not
+        term.move_cursor(list_x, start_y + i);
+        term.write_bg(0, 0, 0);
+        term.write_fg(selected ? Theme::RGB(255, 255, 255) : Theme::RGB(200, 200, 200));
+        term.write(selected ? "> " : "  ");
+        if (title_room > 0) {
+            term.write_clipped(playlists[idx].title, title_room);
+            term.write_fg(150, 150, 150);
+            term.write(std::string_view(count, static_cast<size_t>(std::max(0, count_len))));
+        } else {
+            term.write_clipped(playlists[idx].title, clear_width - 2);
+        }
+        term.write_reset();
     }
 }
 
@@ -2972,8 +3133,8 @@ void PlayerView::draw_tracks_list(const Layout& /*layout*/) {
     bool has_track_album_art = false;
     
     if (show_album_art && config.enable_album_art) {
-        small_art_w = 50;
-        small_art_h = 25;
+        small_art_w = LIBRARY_ART_W;
+        small_art_h = LIBRARY_ART_H;
         small_art_x = w - small_art_w - 2;  // Top-right with 2 char margin
         has_track_album_art = true;
     }
@@ -2993,120 +3154,15 @@ void PlayerView::draw_tracks_list(const Layout& /*layout*/) {
         list_max_width = std::min(list_max_width, small_art_x - list_x - 2);
     }
     
-    // Lazy loading: Load more tracks if user scrolls near the end
-    // For playlists
-    if (!current_playlist_id.empty() && 
-        (playlist_total_size == 0 || playlist_loaded_count < playlist_total_size)) {
-        // Check if we're near the end of loaded tracks (within 20 items)
-        int remaining_loaded = static_cast<int>(browse_tracks.size()) - (visible_start + max_items);
-        if (remaining_loaded < 20 && browse_tracks.size() >= static_cast<size_t>(playlist_loaded_count)) {
-            // Load next chunk
-            try {
-                std::vector<Track> next_chunk = client.get_playlist_tracks(
-                    current_playlist_id, 
-                    playlist_loaded_count, 
-                    PLAYLIST_CHUNK_SIZE
-                );
-                if (!next_chunk.empty()) {
-                    browse_tracks.insert(browse_tracks.end(), next_chunk.begin(), next_chunk.end());
-                    playlist_loaded_count += static_cast<int>(next_chunk.size());
-                }
-            } catch (...) {
-                // Failed to load more - continue with what we have
-            }
-        }
-    }
-    
-    // Lazy loading: Load more search results if user scrolls near the end
-    if (is_search_mode && !current_search_query.empty()) {
-        // Check if we're near the end of loaded search results (within 20 items)
-        int remaining_loaded = static_cast<int>(browse_tracks.size()) - (visible_start + max_items);
-        if (remaining_loaded < 20 && browse_tracks.size() >= static_cast<size_t>(search_loaded_count)) {
-            // Load next chunk of search results
-            try {
-                std::vector<Track> next_chunk = client.search_tracks(
-                    current_search_query,
-                    SEARCH_CHUNK_SIZE,
-                    search_loaded_count
-                );
-                if (!next_chunk.empty()) {
-                    // Deduplicate: Plex search with offset often returns overlapping results.
-                    // Use same ID + signature logic as perform_search().
-                    auto normalize_sig = [](const std::string& title, const std::string& artist, const std::string& album) -> std::string {
-                        std::string sig = title + "|" + artist + "|" + album;
-                        std::transform(sig.begin(), sig.end(), sig.begin(), ::tolower);
-                        sig.erase(std::remove_if(sig.begin(), sig.end(), [](char c) { return std::isspace(c); }), sig.end());
-                        return sig;
-                    };
-                    std::set<std::string> existing_ids;
-                    std::set<std::string> existing_sigs;
-                    for (const auto& t : browse_tracks) {
-                        if (!t.id.empty()) existing_ids.insert(t.id);
-                        existing_sigs.insert(normalize_sig(t.title, t.artist, t.album));
-                    }
-                    int added = 0;
-                    for (const auto& track : next_chunk) {
-                        bool dup = false;
-                        if (!track.id.empty() && existing_ids.find(track.id) != existing_ids.end()) dup = true;
-                        if (!dup) {
-                            std::string sig = normalize_sig(track.title, track.artist, track.album);
-                            if (existing_sigs.find(sig) != existing_sigs.end()) dup = true;
-                        }
-                        if (!dup) {
-                            browse_tracks.push_back(track);
-                            if (!track.id.empty()) existing_ids.insert(track.id);
-                            existing_sigs.insert(normalize_sig(track.title, track.artist, track.album));
-                            ++added;
-                        }
-                    }
-                    search_loaded_count += added;
-                    if (added == 0 && !next_chunk.empty()) {
-                        // All duplicates - stop pagination to avoid infinite loop
-                        is_search_mode = false;
-                    }
-                } else {
-                    // No more results - stop trying
-                    is_search_mode = false;
-                }
-            } catch (...) {
-                // Failed to load more - continue with what we have
-            }
-        }
-    }
+    browse_tracks.show(visible_start, max_items);
     
     // Draw small album art in top-right if viewing album tracks (cached, small size)
-    if (show_album_art && config.enable_album_art) {
+    // (unchanged while only the list scrolls)
+    if (show_album_art && config.enable_album_art && !list_update.partial) {
         try {
-            // Initialize album art object if needed
-            if (!album_art_for_tracks) {
-                album_art_for_tracks = std::make_unique<AlbumArt>();
-            }
-            
-            // Fetch album art if not already loaded or if album changed (cached)
-            static std::string last_album_id;
-            if (last_album_id != current_album_id || !album_art_for_tracks->has_art()) {
-                if (!current_album.art_url.empty()) {
-                    try {
-                        album_art_for_tracks->fetch_art(
-                            client.get_server_url(),
-                            client.get_token(),
-                            current_album.art_url
-                        );
-                    } catch (...) {
-                        // Fetch failed - continue without art
-                    }
-                }
-                last_album_id = current_album_id;
-            }
-            
-            // Render small pixelated album art (cached)
-            if (album_art_for_tracks->has_art()) {
-                auto art_lines = album_art_for_tracks->render_pixelated(small_art_w, small_art_h, config.theme);
-                for (size_t y = 0; y < art_lines.size() && y < static_cast<size_t>(small_art_h); ++y) {
-                    if (small_art_y + static_cast<int>(y) < h && small_art_x >= 0 && small_art_x < w) {
-                        term.draw_text(small_art_x, small_art_y + static_cast<int>(y), art_lines[y]);
-                    }
-                }
+            // Render small pixelated album art (loaded and pre-rendered by art_loader)
+            if (album_art_for_tracks && album_art_for_tracks->has_art()) {
+                draw_art_image(*album_art_for_tracks, small_art_x, small_art_y, small_art_w, small_art_h);
             }
             
             // Draw MusicBrainz album info to the LEFT of album art (if album data enabled)
@@ -3210,32 +3266,26 @@ void PlayerView::draw_tracks_list(const Layout& /*layout*/) {
             if (config.enable_album_data) {
                 int info_x = small_art_x;
                 int info_y = small_art_y + small_art_h + 1;
-                std::string black_bg = term.bg_color(0, 0, 0);
-                std::string title_color = term.fg_color(255, 255, 255);
-                std::string artist_color = term.fg_color(200, 200, 200);
-                std::string year_color = term.fg_color(150, 150, 150);
                 
                 if (info_x >= 0 && info_x < w && info_y >= 0 && info_y < h) {
                     // Draw album title
-                    std::string title = current_album.title;
-                    if (title.length() > static_cast<size_t>(small_art_w)) {
-                        title = title.substr(0, small_art_w - 3) + "...";
-                    }
-                    term.draw_text(info_x, info_y, black_bg + title_color + title + term.reset_color());
+                    term.print_clipped(info_x, info_y, Theme::RGB(255, 255, 255), current_album.title, small_art_w);
                     
                     // Draw artist
                     if (!current_album.artist.empty()) {
-                        std::string artist = current_album.artist;
-                        if (artist.length() > static_cast<size_t>(small_art_w)) {
-                            artist = artist.substr(0, small_art_w - 3) + "...";
-                        }
-                        term.draw_text(info_x, info_y + 1, black_bg + artist_color + artist + term.reset_color());
+                        term.print_clipped(info_x, info_y + 1, Theme::RGB(200, 200, 200),
+                                           current_album.artist, small_art_w);
                     }
                     
                     // Draw year
                     if (current_album.year > 0) {
-                        term.draw_text(info_x, info_y + 2, 
-                                      black_bg + year_color + "(" + std::to_string(current_album.year) + ")" + term.reset_color());
+                        term.move_cursor(info_x, info_y + 2);
+                        term.write_bg(0, 0, 0);
+                        term.write_fg(150, 150, 150);
+                        term.write("(");
+                        term.write_int(current_album.year);
+                        term.write(")");
+                        term.write_reset();
                     }
                 }
             }
@@ -3246,128 +3296,130 @@ void PlayerView::draw_tracks_list(const Layout& /*layout*/) {
     
     // Show message if no tracks
     if (browse_tracks.empty()) {
-        std::string black_bg = term.bg_color(0, 0, 0);
-        std::string msg_color = term.fg_color(config.theme.dimmed.r, config.theme.dimmed.g, config.theme.dimmed.b);
-        term.draw_text(list_x, start_y, black_bg + msg_color + "No tracks found." + term.reset_color());
+        term.print(list_x, start_y, config.theme.dimmed, "No tracks found.");
         return;
     }
     
     // Clear each line before drawing to remove fragments (btop-style)
     // Only clear the area where tracks will be drawn (not album art area)
     int clear_width = list_max_width;
-    if (clear_width > 0 && clear_width <= 1000) {
-        std::string black_bg = term.bg_color(0, 0, 0);
-        std::string clear_line(clear_width, ' ');
-        for (int i = 0; i < max_items; ++i) {
-            term.draw_text(list_x, start_y + i, black_bg + clear_line + term.reset_color());
-        }
-    }
+    begin_list_rows(list_x, start_y, clear_width, max_items);
     
     for (int i = 0; i < max_items && (visible_start + i) < static_cast<int>(browse_tracks.size()); ++i) {
+        if (!list_row_dirty(i)) continue;
         int idx = visible_start + i;
         bool selected = (idx == selected_index);
+        if (!browse_tracks.loaded(idx)) {
+            draw_loading_row(list_x, start_y + i, selected);
+            continue;
+        }
         
         // Bright text - white when selected, dim when not
-        std::string title_color = selected ? 
-            term.fg_color(255, 255, 255) : 
-            term.fg_color(220, 220, 220);
-        
-        std::string artist_color = term.fg_color(180, 180, 180);
-        std::string album_color = term.fg_color(150, 150, 150);
-        std::string time_color = term.fg_color(130, 130, 130);
-        std::string marker = selected ? "> " : "  ";
-        
-        std::string black_bg = term.bg_color(0, 0, 0);
+        const Theme::RGB title_color = selected ? Theme::RGB(255, 255, 255) : Theme::RGB(220, 220, 220);
+        const Theme::RGB artist_color{180, 180, 180};
+        const Theme::RGB album_color{150, 150, 150};
+        const Theme::RGB time_color{130, 130, 130};
+        const Track& track = browse_tracks[idx];
         
         // Build line components and truncate to fit available width
-        std::string time_str = " [" + format_time(browse_tracks[idx].duration_ms) + "]";
-        int time_len = static_cast<int>(time_str.length());
+        // (views into the track, so rows cost no string copies)
+        std::string time_str = format_time(track.duration_ms);  // "mm:ss" fits in SSO
+        int time_len = static_cast<int>(time_str.length()) + 3;  // " [" + time + "]"
         int marker_len = 2;
         int available_for_text = list_max_width - marker_len - time_len;
         if (available_for_text < 10) available_for_text = 10;  // Minimum space
         
-        std::string title = browse_tracks[idx].title;
-        std::string artist_part = "";
-        std::string album_part = "";
-        
-        if (!browse_tracks[idx].artist.empty()) {
-            artist_part = " • " + browse_tracks[idx].artist;
-        }
-        if (!browse_tracks[idx].album.empty()) {
-            album_part = " • " + browse_tracks[idx].album;
-        }
+        std::string_view title = track.title;
+        std::string_view artist = track.artist;
+        bool title_clipped = false;
+        bool artist_clipped = false;
+        bool show_artist = !artist.empty();
+        bool show_album = !track.album.empty();
+        const int sep_len = 5;  // " • " is 5 bytes
         
         // Calculate total text length (without ANSI codes)
-        int total_text_len = static_cast<int>(title.length() + artist_part.length() + album_part.length());
+        auto text_len = [&]() {
+            int len = static_cast<int>(title.length()) + (title_clipped ? 3 : 0);
+            if (show_artist) len += sep_len + static_cast<int>(artist.length());
+            if (show_album) len += sep_len + static_cast<int>(track.album.length());
+            return len;
+        };
         
         // Truncate if needed
-        if (total_text_len > available_for_text) {
+        if (text_len() > available_for_text) {
             // Prioritize: title > artist > album
             int title_max = std::min(static_cast<int>(title.length()), available_for_text - 3);
             if (title_max < 0) title_max = 0;
             
-            if (total_text_len > available_for_text) {
-                // Truncate title first
-                if (title.length() > static_cast<size_t>(title_max)) {
-                    title = title.substr(0, title_max) + "...";
-                    total_text_len = static_cast<int>(title.length() + artist_part.length() + album_part.length());
-                }
-                
-                // If still too long, remove album
-                if (total_text_len > available_for_text && !album_part.empty()) {
-                    album_part = "";
-                    total_text_len = static_cast<int>(title.length() + artist_part.length());
-                }
-                
-                // If still too long, truncate artist
-                if (total_text_len > available_for_text && !artist_part.empty()) {
-                    int artist_available = available_for_text - static_cast<int>(title.length()) - 3;
-                    if (artist_available > 0) {
-                        std::string artist_only = browse_tracks[idx].artist;
-                        if (artist_only.length() > static_cast<size_t>(artist_available)) {
-                            artist_only = artist_only.substr(0, artist_available - 3) + "...";
-                        }
-                        artist_part = " • " + artist_only;
-                    } else {
-                        artist_part = "";
+            // Truncate title first
+            if (title.length() > static_cast<size_t>(title_max)) {
+                title = title.substr(0, static_cast<size_t>(title_max));
+                title_clipped = true;
+            }
+            
+            // If still too long, remove album
+            if (text_len() > available_for_text && show_album) {
+                show_album = false;
+            }
+            
+            // If still too long, truncate artist
+            if (text_len() > available_for_text && show_artist) {
+                int shown_title_len = static_cast<int>(title.length()) + (title_clipped ? 3 : 0);
+                int artist_available = available_for_text - shown_title_len - 3;
+                if (artist_available > 0) {
+                    if (artist.length() > static_cast<size_t>(artist_available)) {
+                        artist = artist.substr(0, static_cast<size_t>(std::max(0, artist_available - 3)));
+                        artist_clipped = true;
                     }
+                } else {
+                    show_artist = false;
                 }
             }
         }
         
-        // Build final line
-        std::string line = black_bg + marker + title_color + title + term.reset_color();
-        if (!artist_part.empty()) {
-            line += black_bg + artist_color + artist_part + term.reset_color();
-        }
-        if (!album_part.empty()) {
-            line += black_bg + album_color + album_part + term.reset_color();
-        }
-        line += black_bg + time_color + time_str + term.reset_color();
-        
-        term.draw_text(list_x, start_y + i, line);
-    }
-    
-    // Show loading indicator if more tracks are available
-    if (!current_playlist_id.empty() && 
-        (playlist_total_size == 0 || playlist_loaded_count < playlist_total_size)) {
-        std::string loading_color = term.fg_color(180, 180, 180);
-        std::string loading_msg;
-        if (playlist_total_size > 0) {
-            loading_msg = "... Loading " + std::to_string(playlist_loaded_count) + 
-                         " of " + std::to_string(playlist_total_size) + " tracks ...";
-        } else {
-            loading_msg = "... Loaded " + std::to_string(playlist_loaded_count) + " tracks (scroll for more) ...";
-        }
-        std::string black_bg = term.bg_color(0, 0, 0);
-        term.draw_text(list_x, start_y + max_items, black_bg + loading_color + loading_msg + term.reset_color());
-    } else if (is_search_mode && !current_search_query.empty()) {
-        // Show loading indicator for search results
-        std::string loading_color = term.fg_color(180, 180, 180);
-        std::string loading_msg = "... Loaded " + std::to_string(search_loaded_count) + 
-                                 " search results (scroll for more) ...";
-        std::string black_bg = term.bg_color(0, 0, 0);
-        term.draw_text(list_x, start_y + max_items, black_bg + loading_color + loading_msg + term.reset_color());
+        // Emit final line straight into the frame buffer
+        term.move_cursor(list_x, start_y + i);
+        term.write_bg(0, 0, 0);
+        term.write(selected ? "> " : "  ");
+        term.write_fg(title_color);
+        term.write(title);
+        if (title_clipped) term.write("...");
+        term.write_reset();
+        if (show_artist) {
+            term.write_bg(0, 0, 0);
+            term.write_fg(artist_color);
+            term.write(" • ");
+            term.write(artist);
+            if (artist_clipped) term.write("...");
+            term.write_reset();
+        }
+        if (show_album) {
+            term.write_bg(0, 0, 0);
+            term.write_fg(album_color);
+            term.write(" • ");
+            term.write(track.album);
+            term.write_reset();
+        }
+        term.write_bg(0, 0, 0);
+        term.write_fg(time_color);
+        term.write(" [");
+        term.write(time_str);
+        term.write("]");
+        term.write_reset();
+    }
+    
+    // Long lists (playlists, search results) page in as they scroll: show how far along the window is
+    if (!current_playlist_id.empty() || (is_search_mode && !current_search_query.empty())) {
+        term.fill(list_x, start_y + max_items, clear_width);
+        term.move_cursor(list_x, start_y + max_items);
+        term.write_bg(0, 0, 0);
+        term.write_fg(180, 180, 180);
+        term.write("... ");
+        term.write_int(std::min(browse_tracks.size(), visible_start + max_items));
+        term.write(" of ");
+        term.write_int(browse_tracks.size());
+        term.write(is_search_mode ? " search results ..." : " tracks ...");
+        term.write_reset();
     }
 }
 
@@ -3375,19 +3427,12 @@ void PlayerView::handle_search_input(char c) {
     if (c == '\b' || c == 127) {  // Backspace
         if (!search_query.empty()) {
             search_query.pop_back();
-            // Immediate search on backspace (user is refining query)
-            last_search_time = std::chrono::steady_clock::now();
-            search_pending = true;
+            search_pending = true;  // Earlier queries come back from the search caches
         } else {
             browse_tracks.clear();
-            // Clear search pagination
             is_search_mode = false;
             current_search_query.clear();
-            search_loaded_count = 0;
-            // Clear playlist pagination
             current_playlist_id.clear();
-            playlist_total_size = 0;
-            playlist_loaded_count = 0;
             search_pending = false;
         }
     } else if (c == '\n' || c == '\r') {  // Enter
@@ -3398,16 +3443,11 @@ void PlayerView::handle_search_input(char c) {
     } else if (c >= 32 && c < 127) {  // Printable character (all alphanumeric and symbols)
         // Allow all printable characters in search (btop-style: full text search)
         search_query += c;
-        // Debounce: schedule search after user stops typing
-        last_search_time = std::chrono::steady_clock::now();
-        search_pending = true;
+        search_pending = true;  // Searched on the next frame
     }
     // Note: Non-printable characters are ignored (handled by caller)
 }
 
-// Note: url_encode function removed - duplicate of PlexClient::Impl::url_encode
-// If needed, use PlexClient's internal implementation or create a shared utility
-
 void PlayerView::draw_lyrics(const Layout& layout) {
     int lyrics_x = layout.waveform_x;
     int lyrics_w = layout.waveform_w;
@@ -3426,17 +3466,23 @@ void PlayerView::draw_lyrics(const Layout& layout) {
     int center_offset = visible_lines / 2;
     int h = term.height();
     if (h <= 0) h = 24;
-    std::string black_bg = term.bg_color(0, 0, 0);
+    
+    // Centered line: leading pad is written as blanks so it also clears stale text
+    auto draw_centered = [&](int y, const Theme::RGB& color, std::string_view text) {
+        int pad = (lyrics_w - static_cast<int>(text.length())) / 2;
+        if (pad < 0) pad = 0;
+        term.move_cursor(lyrics_x, y);
+        term.write_bg(0, 0, 0);
+        term.write_fg(color);
+        term.write_repeat(" ", pad);
+        term.write(text);
+        term.write_reset();
+    };
 
     if (pending_play) {
-        std::string hint = "Fetching lyrics…";
-        std::string dim = term.fg_color(150, 150, 150);
-        int pad = (lyrics_w - static_cast<int>(hint.length())) / 2;
-        if (pad < 0) pad = 0;
-        std::string line = std::string(pad, ' ') + hint;
         int y = lyrics_y + center_offset;
         if (y >= 0 && y < h)
-            term.draw_text(lyrics_x, y, black_bg + dim + line + term.reset_color());
+            draw_centered(y, Theme::RGB(150, 150, 150), "Fetching lyrics…");
         return;
     }
 
@@ -3479,43 +3525,27 @@ void PlayerView::draw_lyrics(const Layout& layout) {
         }
         
         // Find the lyric line that should be displayed at current position
-        int current_line_idx = -1;
-        for (size_t i = 0; i < synced_lyrics.size(); ++i) {
-            if (synced_lyrics[i].timestamp_ms <= current_pos_ms) {
-                current_line_idx = static_cast<int>(i);
-            } else {
-                break;  // Lines are sorted by timestamp
-            }
-        }
-        if (current_line_idx < 0 && !synced_lyrics.empty()) {
-            current_line_idx = 0;  // Before first timestamp: show first line
-        }
+        int current_line_idx = current_synced_lyric_index();
         
         // Display lines around the current one
         for (int i = 0; i < visible_lines; ++i) {
             int line_idx = current_line_idx + i - center_offset;
             if (line_idx >= 0 && line_idx < static_cast<int>(synced_lyrics.size())) {
-                std::string line_text = synced_lyrics[line_idx].text;
-                
-                // Truncate to fit width
-                if (static_cast<int>(line_text.length()) > lyrics_w) {
-                    line_text = line_text.substr(0, lyrics_w - 3) + "...";
-                }
+                std::string_view line_text = synced_lyrics[line_idx].text;
                 
                 // Fade effect: center line is brightest, fade out towards edges
                 int distance_from_center = std::abs(i - center_offset);
                 uint8_t brightness = 255 - (distance_from_center * 80);  // Fade: 255, 175, 95
                 if (brightness < 100) brightness = 100;  // Minimum visibility
                 
-                std::string lyrics_color = term.fg_color(brightness, brightness, brightness);
-                
-                // Center the line text
-                int padding = (lyrics_w - static_cast<int>(line_text.length())) / 2;
-                if (padding < 0) padding = 0;
-                std::string centered_line = std::string(padding, ' ') + line_text;
-                
+                // Truncate to fit width, then center the line text
                 if (lyrics_y + i >= 0 && lyrics_y + i < h) {
-                    term.draw_text(lyrics_x, lyrics_y + i, black_bg + lyrics_color + centered_line + term.reset_color());
+                    if (static_cast<int>(line_text.length()) > lyrics_w) {
+                        term.print_clipped(lyrics_x, lyrics_y + i, Theme::RGB(brightness, brightness, brightness),
+                                           line_text, lyrics_w);
+                    } else {
+                        draw_centered(lyrics_y + i, Theme::RGB(brightness, brightness, brightness), line_text);
+                    }
                 }
             }
         }
@@ -3550,30 +3580,75 @@ void PlayerView::draw_lyrics(const Layout& layout) {
         for (int i = 0; i < visible_lines; ++i) {
             int line_idx = lyrics_scroll_position + i;
             if (line_idx < 0 || line_idx >= static_cast<int>(lyrics_lines.size())) continue;
-            std::string line_text = lyrics_lines[line_idx];
-            if (static_cast<int>(line_text.length()) > lyrics_w) {
-                line_text = line_text.substr(0, lyrics_w - 3) + "...";
-            }
+            std::string_view line_text = lyrics_lines[line_idx];
             uint8_t brightness = 255 - (i * 25);
             if (brightness < 150) brightness = 150;
-            std::string lyrics_color = term.fg_color(brightness, brightness, brightness);
-            int padding = (lyrics_w - static_cast<int>(line_text.length())) / 2;
-            if (padding < 0) padding = 0;
-            std::string centered_line = std::string(padding, ' ') + line_text;
             if (lyrics_y + i >= 0 && lyrics_y + i < h) {
-                term.draw_text(lyrics_x, lyrics_y + i, black_bg + lyrics_color + centered_line + term.reset_color());
+                if (static_cast<int>(line_text.length()) > lyrics_w) {
+                    term.print_clipped(lyrics_x, lyrics_y + i, Theme::RGB(brightness, brightness, brightness),
+                                       line_text, lyrics_w);
+                } else {
+                    draw_centered(lyrics_y + i, Theme::RGB(brightness, brightness, brightness), line_text);
+                }
             }
         }
         if (max_scroll > 0 && available > visible_lines && lyrics_y + visible_lines >= 0 && lyrics_y + visible_lines < h) {
-            std::string hint = "↑↓ scroll";
-            std::string dim = term.fg_color(100, 100, 100);
-            int pad = (lyrics_w - static_cast<int>(hint.length())) / 2;
-            if (pad < 0) pad = 0;
-            term.draw_text(lyrics_x, lyrics_y + visible_lines, black_bg + dim + std::string(pad, ' ') + hint + term.reset_color());
+            draw_centered(lyrics_y + visible_lines, Theme::RGB(100, 100, 100), "↑↓ scroll");
         }
     }
 }
 
+namespace {
+
+// Options menu entries - shared by the overlay renderer and its input handler
+struct MenuOption {
+    std::string_view name;
+    std::string_view key;
+    bool is_bool;
+    bool is_int;
+};
+
+const std::vector<std::vector<MenuOption>>& options_menu_table() {
+    static const std::vector<std::vector<MenuOption>> table = {
+        // Plex
+        {{"Server URL", "plex_server_url", false, false},
+         {"Token", "plex_token", false, false},
+         {"Config File", "config_file_path", false, false}},  // Read-only display
+        // Display
+        {{"Max Waveform Points", "max_waveform_points", false, true},
+         {"Refresh Rate (ms)", "refresh_rate_ms", false, true},
+         {"Window Width", "window_width", false, true},
+         {"Window Height", "window_height", false, true}},
+        // Features
+        {{"Enable Waveform", "enable_waveform", true, false},
+         {"Enable Lyrics", "enable_lyrics", true, false},
+         {"Enable Album Art", "enable_album_art", true, false},
+         {"Enable Album Data", "enable_album_data", true, false},
+         {"Enable Debug Logging", "enable_debug_logging", true, false},
+         {"Debug Log File Path", "debug_log_file_path", false, false}}
+    };
+    return table;
+}
+
+bool get_bool_option(const Config& config, std::string_view key) {
+    if (key == "enable_waveform") return config.enable_waveform;
+    if (key == "enable_lyrics") return config.enable_lyrics;
+    if (key == "enable_album_art") return config.enable_album_art;
+    if (key == "enable_album_data") return config.enable_album_data;
+    if (key == "enable_debug_logging") return config.enable_debug_logging;
+    return false;
+}
+
+int get_int_option(const Config& config, std::string_view key) {
+    if (key == "max_waveform_points") return config.max_waveform_points;
+    if (key == "refresh_rate_ms") return config.refresh_rate_ms;
+    if (key == "window_width") return config.window_width;
+    if (key == "window_height") return config.window_height;
+    return 0;
+}
+
+} // namespace
+
 void PlayerView::draw_options_menu() {
     int w = term.width();
     int h = term.height();
@@ -3585,39 +3660,45 @@ void PlayerView::draw_options_menu() {
     int menu_x = (w - menu_w) / 2;
     int menu_y = (h - menu_h) / 2;
     
-    std::string black_bg = term.bg_color(0, 0, 0);
-    std::string orange_color = term.fg_color(255, 140, 0);  // Plex orange
-    std::string white = term.fg_color(255, 255, 255);
-    std::string dim = term.fg_color(150, 150, 150);
-    std::string selected_bg = term.bg_color(30, 20, 10);  // Dark orange tint for selection
-    std::string selected_fg = orange_color;  // Orange text for selected items
+    const Theme::RGB black{0, 0, 0};
+    const Theme::RGB orange_color{255, 140, 0};  // Plex orange
+    const Theme::RGB white{255, 255, 255};
+    const Theme::RGB dim{150, 150, 150};
+    const Theme::RGB selected_bg{30, 20, 10};  // Dark orange tint for selection
     
     // Draw semi-transparent overlay background (darken screen)
     for (int y = 0; y < h; ++y) {
-        for (int x = 0; x < w; ++x) {
-            term.draw_text(x, y, term.bg_color(0, 0, 0) + " " + term.reset_color());
-        }
+        term.fill(0, y, w);
     }
     
     // Draw menu box (btop-style: orange border)
     term.draw_box(menu_x, menu_y, menu_w, menu_h, "Options");
     
     // Category tabs (btop-style with orange hotkeys)
-    std::vector<std::string> categories = {"Plex", "Display", "Features"};
+    static const char* const categories[] = {"Plex", "Display", "Features"};
     int tab_x = menu_x + 2;
     int tab_y = menu_y + 1;
-    for (size_t i = 0; i < categories.size(); ++i) {
-        bool is_active = (i == static_cast<size_t>(options_menu_category));
-        std::string tab_text;
+    for (int i = 0; i < 3; ++i) {
+        bool is_active = (i == options_menu_category);
+        term.move_cursor(tab_x, tab_y);
+        term.write_bg(black);
         if (is_active) {
             // Active: [Category] with orange brackets
-            tab_text = orange_color + "[" + white + categories[i] + orange_color + "]";
+            term.write_fg(orange_color);
+            term.write("[");
+            term.write_fg(white);
+            term.write(categories[i]);
+            term.write_fg(orange_color);
+            term.write("]");
         } else {
             // Inactive: "1 Category" with orange hotkey
-            std::string hotkey = std::to_string(i + 1);
-            tab_text = orange_color + hotkey + dim + " " + categories[i];
+            term.write_fg(orange_color);
+            term.write_int(i + 1);
+            term.write_fg(dim);
+            term.write(" ");
+            term.write(categories[i]);
         }
-        term.draw_text(tab_x, tab_y, black_bg + tab_text + term.reset_color());
+        term.write_reset();
         tab_x += 18;  // Slightly tighter spacing
     }
     
@@ -3625,185 +3706,122 @@ void PlayerView::draw_options_menu() {
     int opt_y = menu_y + 3;
     int max_visible = menu_h - 5;
     
-    // Define options for each category
-    struct Option {
-        std::string name;
-        std::string key;
-        bool is_bool;
-        bool is_int;
-    };
-    
-    std::vector<std::vector<Option>> category_options = {
-        // Plex
-        {{"Server URL", "plex_server_url", false, false},
-         {"Token", "plex_token", false, false},
-         {"Config File", "config_file_path", false, false}},  // Show config file path
-        // Display
-        {{"Max Waveform Points", "max_waveform_points", false, true},
-         {"Refresh Rate (ms)", "refresh_rate_ms", false, true},
-         {"Window Width", "window_width", false, true},
-         {"Window Height", "window_height", false, true}},
-        // Features
-        {{"Enable Waveform", "enable_waveform", true, false},
-         {"Enable Lyrics", "enable_lyrics", true, false},
-         {"Enable Album Art", "enable_album_art", true, false},
-         {"Enable Album Data", "enable_album_data", true, false},
-         {"Enable Debug Logging", "enable_debug_logging", true, false},
-         {"Debug Log File Path", "debug_log_file_path", false, false}}
-    };
-    
-    auto& options = category_options[options_menu_category];
+    const auto& options = options_menu_table()[options_menu_category];
     int start_idx = std::max(0, options_menu_selected - max_visible + 1);
     int end_idx = std::min(static_cast<int>(options.size()), start_idx + max_visible);
     
+    // Default paths only depend on HOME - resolve once
+    static const std::string config_file_path = [] {
+        const char* home = getenv("HOME");
+        return home ? std::string(home) + "/.config/plex-tui/config.ini" : std::string("~/.config/plex-tui/config.ini");
+    }();
+    static const std::string default_log_path = [] {
+        const char* home = getenv("HOME");
+        return (home ? std::string(home) + "/.config/plex-tui/debug.log" : std::string("~/.config/plex-tui/debug.log")) +
+               " (default)";
+    }();
+    
     for (int i = start_idx; i < end_idx; ++i) {
         if (i >= static_cast<int>(options.size())) break;
         const auto& opt = options[i];
         bool is_selected = (i == options_menu_selected);
         
-        std::string bg_color = is_selected ? selected_bg : black_bg;
-        std::string fg_color = is_selected ? selected_fg : white;
+        const Theme::RGB& bg_color = is_selected ? selected_bg : black;
         
         // Option name (btop-style: orange for selected)
         // Use fixed smaller width for names to give more space to values
         int max_name_len = 18;  // Fixed width for names (allows more space for values)
-        std::string name_text = opt.name;
-        if (name_text.length() > static_cast<size_t>(max_name_len)) {
-            name_text = name_text.substr(0, max_name_len - 3) + "...";
-        }
-        std::string name_color = is_selected ? orange_color : white;
-        term.draw_text(menu_x + 2, opt_y, bg_color + name_color + name_text + term.reset_color());
+        term.print_clipped(menu_x + 2, opt_y, is_selected ? orange_color : white, opt.name, max_name_len, bg_color);
         
         // Option value (starts earlier to show more of URL)
         int value_x = menu_x + max_name_len + 3;  // Start value column earlier
         int max_value_width = menu_w - (value_x - menu_x) - 2;  // Remaining space for value
         
-        std::string value_text;
-        if (opt.is_bool) {
-            bool val = false;
-            if (opt.key == "enable_waveform") val = config.enable_waveform;
-            else if (opt.key == "enable_lyrics") val = config.enable_lyrics;
-            else if (opt.key == "enable_album_art") val = config.enable_album_art;
-            else if (opt.key == "enable_album_data") val = config.enable_album_data;
-            else if (opt.key == "enable_debug_logging") val = config.enable_debug_logging;
-            value_text = val ? "true" : "false";
+        // Value color: orange if selected, white otherwise
+        // Config file path is read-only (dimmed)
+        const Theme::RGB& value_color = (opt.key == "config_file_path") ? dim :
+                                        (is_selected ? orange_color : white);
+        
+        term.move_cursor(value_x, opt_y);
+        term.write_bg(bg_color);
+        term.write_fg(value_color);
+        if (is_selected && options_menu_editing && opt.key == options_menu_edit_option) {
+            term.write(options_menu_edit_buffer);
+            term.write("_");
+        } else if (opt.is_bool) {
+            term.write(get_bool_option(config, opt.key) ? "true" : "false");
         } else if (opt.is_int) {
-            int val = 0;
-            if (opt.key == "max_waveform_points") val = config.max_waveform_points;
-            else if (opt.key == "refresh_rate_ms") val = config.refresh_rate_ms;
-            else if (opt.key == "window_width") val = config.window_width;
-            else if (opt.key == "window_height") val = config.window_height;
-            value_text = std::to_string(val);
+            term.write_int(get_int_option(config, opt.key));
+        } else if (opt.key == "plex_token") {
+            // Hide token
+            term.write_repeat("*", std::min(static_cast<int>(config.plex_token.length()), max_value_width));
         } else {
+            std::string_view value_text;
             if (opt.key == "plex_server_url") {
                 value_text = config.plex_server_url;
-            } else if (opt.key == "plex_token") {
-                value_text = std::string(config.plex_token.length(), '*');  // Hide token
             } else if (opt.key == "config_file_path") {
                 // Show config file path
-                const char* home = getenv("HOME");
-                value_text = (home ? std::string(home) + "/.config/plex-tui/config.ini" : "~/.config/plex-tui/config.ini");
+                value_text = config_file_path;
             } else if (opt.key == "debug_log_file_path") {
                 // Show debug log file path (or default if empty)
-                if (!config.debug_log_file_path.empty()) {
-                    value_text = config.debug_log_file_path;
-                } else {
-                    const char* home = getenv("HOME");
-                    value_text = (home ? std::string(home) + "/.config/plex-tui/debug.log" : "~/.config/plex-tui/debug.log");
-                    value_text += " (default)";
-                }
+                value_text = config.debug_log_file_path.empty() ? std::string_view(default_log_path)
+                                                                : std::string_view(config.debug_log_file_path);
             }
             // Truncate if too long, but allow more space now
-            if (value_text.length() > static_cast<size_t>(max_value_width)) {
-                value_text = value_text.substr(0, max_value_width - 3) + "...";
-            }
-        }
-        
-        if (is_selected && options_menu_editing && opt.key == options_menu_edit_option) {
-            value_text = options_menu_edit_buffer + "_";
+            term.write_clipped(value_text, max_value_width);
         }
-        
-        // Value color: orange if selected, white otherwise
-        // Config file path is read-only (dimmed)
-        std::string value_color;
-        if (opt.key == "config_file_path") {
-            value_color = dim;  // Read-only, dimmed
-        } else {
-            value_color = is_selected ? orange_color : white;
-        }
-        term.draw_text(value_x, opt_y, bg_color + value_color + value_text + term.reset_color());
+        term.write_reset();
         opt_y++;
         
         // Show description/hint for selected option (btop-style)
         if (is_selected && opt_y < menu_y + menu_h - 3) {
-            std::string desc_text;
+            std::string_view desc_text;
             if (opt.key == "plex_server_url") {
-                desc_text = dim + "Include port if needed (e.g., :32400, :443, :80)";
+                desc_text = "Include port if needed (e.g., :32400, :443, :80)";
             } else if (opt.key == "plex_token") {
-                desc_text = dim + "Your Plex authentication token";
+                desc_text = "Your Plex authentication token";
             } else if (opt.key == "config_file_path") {
-                desc_text = dim + "Read-only: location of config file";
+                desc_text = "Read-only: location of config file";
             } else if (opt.key == "debug_log_file_path") {
-                desc_text = dim + "Path to debug log file (default: next to config.ini)";
+                desc_text = "Path to debug log file (default: next to config.ini)";
             } else if (opt.key == "max_waveform_points") {
-                desc_text = dim + "Number of waveform data points to display";
+                desc_text = "Number of waveform data points to display";
             } else if (opt.key == "refresh_rate_ms") {
-                desc_text = dim + "UI refresh rate in milliseconds (lower = smoother)";
+                desc_text = "UI refresh rate in milliseconds (lower = smoother)";
             } else if (opt.key == "window_width") {
-                desc_text = dim + "Terminal width in characters (columns)";
+                desc_text = "Terminal width in characters (columns)";
             } else if (opt.key == "window_height") {
-                desc_text = dim + "Terminal height in characters (rows)";
+                desc_text = "Terminal height in characters (rows)";
             }
             
             if (!desc_text.empty() && opt_y < menu_y + menu_h - 3) {
                 // Truncate description if too long
-                int max_desc_width = menu_w - 4;
-                if (desc_text.length() > static_cast<size_t>(max_desc_width)) {
-                    desc_text = desc_text.substr(0, max_desc_width - 3) + "...";
-                }
-                term.draw_text(menu_x + 2, opt_y, black_bg + desc_text + term.reset_color());
+                term.print_clipped(menu_x + 2, opt_y, dim, desc_text, menu_w - 4);
                 opt_y++;
             }
         }
     }
     
     // Help text at bottom (btop-style: orange hotkeys)
-    std::string help_text = orange_color + "Tab" + dim + ": switch | " + 
-                           orange_color + "Enter" + dim + ": edit | " +
-                           orange_color + "←→" + dim + ": change | " +
-                           orange_color + "Esc" + dim + ": close | " +
-                           orange_color + "S" + dim + ": save";
-    term.draw_text(menu_x + 2, menu_y + menu_h - 2, black_bg + help_text + term.reset_color());
+    static const char* const help_keys[][2] = {
+        {"Tab", ": switch | "}, {"Enter", ": edit | "}, {"←→", ": change | "}, {"Esc", ": close | "}, {"S", ": save"}
+    };
+    term.move_cursor(menu_x + 2, menu_y + menu_h - 2);
+    term.write_bg(black);
+    for (const auto& item : help_keys) {
+        term.write_fg(orange_color);
+        term.write(item[0]);
+        term.write_fg(dim);
+        term.write(item[1]);
+    }
+    term.write_reset();
 }
 
 void PlayerView::handle_options_menu_input(const InputEvent& event) {
     if (event.is_mouse()) return;  // Mouse not supported in menu yet
     
-    // Define options for each category (same as in draw_options_menu)
-    struct Option {
-        std::string name;
-        std::string key;
-        bool is_bool;
-        bool is_int;
-    };
-    
-    std::vector<std::vector<Option>> category_options = {
-        {{"Server URL", "plex_server_url", false, false},
-         {"Token", "plex_token", false, false},
-         {"Config File", "config_file_path", false, false}},  // Read-only display
-        {{"Max Waveform Points", "max_waveform_points", false, true},
-         {"Refresh Rate (ms)", "refresh_rate_ms", false, true},
-         {"Window Width", "window_width", false, true},
-         {"Window Height", "window_height", false, true}},
-        {{"Enable Waveform", "enable_waveform", true, false},
-         {"Enable Lyrics", "enable_lyrics", true, false},
-         {"Enable Album Art", "enable_album_art", true, false},
-         {"Enable Album Data", "enable_album_data", true, false},
-         {"Enable Debug Logging", "enable_debug_logging", true, false},
-         {"Debug Log File Path", "debug_log_file_path", false, false}}
-    };
-    
-    auto& options = category_options[options_menu_category];
+    // Options table is shared with draw_options_menu
+    const auto& options = options_menu_table()[options_menu_category];
     
     if (options_menu_editing) {
         // Handle text input for editing
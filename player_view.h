@@ -5,7 +5,11 @@
 #include "input.h"
 #include "plex_client.h"
 #include "audio_decoder.h"
+#include "art_loader.h"
+#include "virtual_list.h"
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 
 namespace PlexTUI {
@@ -58,6 +62,52 @@ private:
     
     // Resize handling (btop-style)
     bool need_bg_fill = true;  // Force background fill on resize
+    bool last_options_menu_active = false;  // Closing the overlay needs a full repaint
+    
+    // Damage tracking: each section hashes the state it renders from and only
+    // repaints (clearing its own rect first) when that hash changes. Waveform
+    // and progress bar repaint every frame; chrome is painted last, on top.
+    struct Rect {
+        int x = 0, y = 0, w = 0, h = 0;
+        bool intersects(const Rect& o) const {
+            return w > 0 && h > 0 && o.w > 0 && o.h > 0 &&
+                   x < o.x + o.w && o.x < x + w && y < o.y + o.h && o.y < y + h;
+        }
+    };
+    enum class Section {
+        Sidebar, Library, AlbumArt, Waveform, Lyrics, TrackInfo, Progress, Controls, StatusBar, Chrome,
+        Count
+    };
+    struct SectionState {
+        uint64_t state = 0;
+        bool valid = false;  // Drawn since the last invalidate
+        bool used = false;   // Part of the current frame
+        bool dirty = false;  // Repaint this frame
+        Rect rect;           // Cleared before repainting
+    };
+    std::array<SectionState, static_cast<size_t>(Section::Count)> sections;
+    SectionState& section(Section s) { return sections[static_cast<size_t>(s)]; }
+    void mark_section(Section s, uint64_t state, const Rect& rect);
+    void invalidate_sections();
+    void clear_rect(const Rect& rect);
+    
+    // Library list scrolling: when only the selection or scroll position moved,
+    // the visible rows are hardware-scrolled (Terminal::scroll_rect) and just the
+    // exposed rows plus the old/new highlighted rows are repainted
+    struct ListUpdate {
+        bool partial = false;       // This frame paints only the flagged rows
+        int scroll_delta = 0;       // scroll_offset change since the last paint
+        int prev_selected = -1;     // Highlighted row to repaint as unselected
+        int drawn_selected = -1;    // Selection/scroll as last painted
+        int drawn_scroll = 0;
+        std::vector<uint8_t> rows;  // Per visible row: paint it this frame
+    };
+    ListUpdate list_update;
+    void begin_list_rows(int x, int y, int w, int rows);
+    void draw_loading_row(int x, int y, bool selected);
+    bool list_row_dirty(int row) const {
+        return row >= 0 && row < static_cast<int>(list_update.rows.size()) && list_update.rows[row];
+    }
     
     // UI components
     std::unique_ptr<Waveform> waveform;
@@ -66,6 +116,8 @@ private:
     PlaybackState playback_state;
     AudioLevels cached_audio_levels;  // Cache to avoid multiple calls per frame
     std::string status_message;
+    std::string status_message_source;  // status_message as last seen by draw_status_bar
+    std::string status_message_plain;   // ...with ANSI escapes stripped (cached per change)
     
     // Library browsing state
     enum class BrowseMode {
@@ -75,24 +127,43 @@ private:
         Tracks
     };
     BrowseMode browse_mode = BrowseMode::Artists;
-    std::vector<PlexClient::Artist> artists;
-    std::vector<PlexClient::Album> albums;
-    std::vector<PlexClient::Playlist> playlists;
-    std::vector<Track> browse_tracks;
+    // Browse lists hold the pages around what's on screen; the sidebar scrolls
+    // through playlists on its own, so it keeps a list of its own
+    static constexpr int BROWSE_PAGE_SIZE = 100;
+    VirtualList<PlexClient::Artist> artists{[this](uint64_t id) { client.cancel_request(id); }, BROWSE_PAGE_SIZE};
+    VirtualList<PlexClient::Album> albums{[this](uint64_t id) { client.cancel_request(id); }, BROWSE_PAGE_SIZE};
+    VirtualList<PlexClient::Playlist> playlists{[this](uint64_t id) { client.cancel_request(id); }, BROWSE_PAGE_SIZE};
+    VirtualList<PlexClient::Playlist> sidebar_playlists{[this](uint64_t id) { client.cancel_request(id); },
+                                                        BROWSE_PAGE_SIZE};
+    VirtualList<Track> browse_tracks{[this](uint64_t id) { client.cancel_request(id); }, BROWSE_PAGE_SIZE};
+    
+    // VirtualList source over a paged PlexClient call (call(start, count, done) -> request id)
+    template <typename T, typename Call>
+    static typename VirtualList<T>::Fetch page_source(Call call) {
+        return [call](int start, int count, typename VirtualList<T>::Done done) {
+            return call(start, count, [done = std::move(done)](PlexClient::Page<T> page) {
+                done(std::move(page.items), page.total, page.ok);
+            });
+        };
+    }
     
-    // Pagination for large playlists
-    std::string current_playlist_id;
-    int playlist_total_size = 0;  // Total tracks in current playlist
-    int playlist_loaded_count = 0;  // Number of tracks loaded so far
-    static const int PLAYLIST_CHUNK_SIZE = 100;  // Load 100 tracks at a time
+    std::string current_playlist_id;  // Playlist whose tracks are listed
     
     // Current album info (when viewing tracks from an album)
     std::string current_album_id;
     PlexClient::Album current_album;
-    std::unique_ptr<AlbumArt> album_art_for_tracks;  // Album art for tracks view (small, cached)
-    std::unique_ptr<AlbumArt> artist_art;  // Artist art for artist view (random pic)
+    std::shared_ptr<AlbumArt> album_art_for_tracks;  // Album art for tracks view (small, from art_loader)
+    std::shared_ptr<AlbumArt> artist_art;  // Artist art for artist view (from art_loader)
     std::unique_ptr<AlbumArt> album_art_for_albums;  // Album art for albums view (selected album)
     
+    // Library art is fetched in the background: each frame asks for the selection
+    // and its neighbours, then shows whatever has finished loading
+    ArtLoader art_loader;
+    static constexpr int LIBRARY_ART_W = 50;  // Artist pic / album art beside tracks (cells)
+    static constexpr int LIBRARY_ART_H = 25;
+    static constexpr int ART_PREFETCH_RADIUS = 3;  // Neighbours prefetched on each side
+    void update_library_art();
+    
     // Lyrics for current track
     std::string current_lyrics;
     std::vector<std::string> lyrics_lines;  // Parsed lyrics lines (for non-synced)
@@ -106,19 +177,26 @@ private:
     std::chrono::steady_clock::time_point pending_play_since;
     std::string prefetch_next_track_id;  // Don't re-prefetch same next track
     
-    // Pagination for search results
+    // Search results (browse_tracks pages through them)
     bool is_search_mode = false;  // True when viewing search results
-    std::string current_search_query;  // Current search query for lazy loading
-    int search_loaded_count = 0;  // Number of search results loaded so far
-    static const int SEARCH_CHUNK_SIZE = 50;  // Load 50 search results at a time
+    std::string current_search_query;  // Query the results are for
+    
+    // Library requests run asynchronously (PlexClient::*_async) and land in
+    // callbacks on the UI loop. A navigation response is applied only while its
+    // generation is still current, so a newer selection supersedes an older one.
+    uint64_t browse_request_id = 0;   // select_item() navigation in flight
+    uint64_t browse_generation = 0;
+    uint64_t search_request_id = 0;   // perform_search() first page in flight
+    uint64_t library_index_version = 0;  // Local library snapshot the top-level lists came from
+    uint64_t begin_browse_request();  // Cancel the pending navigation, return a new generation
+    void apply_search_results(PlexClient::Page<Track> first_page);
     int selected_index = 0;
     int scroll_offset = 0;
     int playlist_scroll_offset = 0;  // Separate scroll for sidebar playlists
     std::string search_query;
     bool search_active = false;
     int music_library_id = -1;
-    std::chrono::steady_clock::time_point last_search_time;  // For debouncing search
-    bool search_pending = false;  // Flag to indicate search needs to be performed
+    bool search_pending = false;  // Query changed: search on the next update()
     
     // Layout calculations
     struct Layout {
@@ -139,6 +217,10 @@ private:
     void draw_title(const Layout& layout);  // Application title above waveform
     void draw_waveform(const Layout& layout);
     void draw_album_art(const Layout& layout);
+    // Art into a cell rect: half-block lines, or a kitty/sixel image when enabled
+    void draw_art_image(AlbumArt& art, int x, int y, int w, int h);
+    // Kitty images float above text - remove them before their sections repaint
+    void clear_art_images();
     void draw_plex_logo_placeholder(const Layout& layout);  // Pixelated Plex logo when no art
     void draw_track_info(const Layout& layout);
     void draw_controls(const Layout& layout);
@@ -147,12 +229,16 @@ private:
     
     // Library view rendering
     void draw_library_view(const Layout& layout);
+    void draw_browse_list(const Layout& layout);  // List for the current browse_mode
+    int browse_item_count() const;
     void draw_search_bar(const Layout& layout);
     void draw_artists_list(const Layout& layout);
     void draw_albums_list(const Layout& layout);
     void draw_playlists_list(const Layout& layout);
     void draw_tracks_list(const Layout& layout);
     void draw_lyrics(const Layout& layout);  // Scrolling lyrics under waveform
+    bool lyrics_visible();  // Player view with a track (or pending play) and lyrics enabled
+    int current_synced_lyric_index() const;  // Line at playback position, -1 without synced lyrics
     
     // Input handlers
     void handle_playback_key(Key key);
@@ -164,7 +250,15 @@ private:
     void load_library_data();
     void perform_search();
     void select_item();
+    void open_playlist(const PlexClient::Playlist& playlist);  // List its tracks (from the browse list or sidebar)
     void advance_to_next_track();  // Auto-advance to next track when current finishes
+    
+    // Shuffle (S in a track list): the listed tracks in random order, played in
+    // place of the list's own order. A playlist is downloaded in full first.
+    std::vector<Track> shuffle_queue;
+    size_t shuffle_position = 0;  // Playing shuffle_queue[shuffle_position]
+    void shuffle_play();
+    void start_shuffle(std::vector<Track> tracks);
 
     // Start playback: fetch lyrics first (hint + up to ~1.5s), then play; or play immediately if instant lyrics
     void start_play_with_lyrics(const Track& track);
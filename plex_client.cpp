@@ -2,6 +2,12 @@
 #include <iostream>
 #include "audio_decoder.h"
 #include "plex_xml.h"
+#include "plex_json.h"
+#include "http_executor.h"
+#include "http_pool.h"
+#include "response_cache.h"
+#include "page_fetcher.h"
+#include "url_encode.h"
 #include <curl/curl.h>
 #include <random>
 #include <cmath>
@@ -13,6 +19,7 @@
 #include <thread>
 #include <queue>
 #include <map>
+#include <unordered_map>
 #include <condition_variable>
 #include <cstdio>
 #include <memory>
@@ -45,6 +52,14 @@ void PlexClient::set_debug_log_file_path(const std::string& path) {
     g_debug_log_file_path = path;
 }
 
+// Plex field types that carry lyrics ("lyrics" plain, the others possibly
+// time-synced from LyricFind on Plex Pass)
+static bool is_lyrics_field(const std::string& type) {
+    return type == "lyrics" || type == "lyric" ||
+           type == "lyricsTimed" || type == "lyrics_timed" ||
+           type == "lyricsSynced" || type == "lyrics_synced";
+}
+
 static void log_lyrics_fetch(const std::string& message) {
     if (!g_lyrics_debug_logging.load()) return;
     
@@ -91,6 +106,58 @@ struct PlexClient::Impl {
     CURL* curl = nullptr;
     std::string response_buffer;
     
+    // Library requests that must not block the UI
+    std::unique_ptr<HttpExecutor> executor;
+    
+    // Library responses for repeat navigation (shared by sync and async requests)
+    static constexpr size_t RESPONSE_CACHE_BYTES = 16 * 1024 * 1024;
+    ResponseCache response_cache{RESPONSE_CACHE_BYTES};
+    
+    // Local library snapshot and its background sync (see start_library_sync)
+    std::unique_ptr<LibrarySync> library_sync;
+    std::unique_ptr<SearchCache> search_cache;  // Recent local searches (UI thread), for the current snapshot
+    
+    // Identical requests in flight (request_async) share one transfer and one parse,
+    // answered to every caller. Each caller gets an id of its own: cancel_request()
+    // drops that caller, and once none are left the transfer stops on the next
+    // run_async_completions(), so a request cancelled and made again straight away
+    // (a double click superseding itself) keeps it. UI thread only.
+    struct Flight {
+        uint64_t serial = 0;    // Tells the flight a late answer belongs to from a newer one
+        uint64_t transfer = 0;  // HttpExecutor id
+        std::vector<std::pair<uint64_t, std::function<void(const std::shared_ptr<const void>&)>>> waiters;
+    };
+    std::unordered_map<std::string, Flight> flights;      // By endpoint and result type
+    std::unordered_map<uint64_t, std::string> flight_of;  // Caller id -> its flight
+    std::vector<std::pair<std::string, uint64_t>> orphaned;  // Flights whose callers all cancelled (key, serial)
+    uint64_t next_request_id = 1;
+    
+    void finish_flight(const std::string& key, uint64_t serial, const std::shared_ptr<const void>& result) {
+        auto it = flights.find(key);
+        if (it == flights.end() || it->second.serial != serial) return;  // Every caller cancelled
+        auto waiters = std::move(it->second.waiters);
+        flights.erase(it);
+        for (const auto& waiter : waiters) {
+            flight_of.erase(waiter.first);
+        }
+        for (const auto& waiter : waiters) {
+            try {
+                waiter.second(result);
+            } catch (...) {
+                // One failed handler must not keep the answer from the others
+            }
+        }
+    }
+    
+    // Bulk loads (load_playlist_tracks_async); cancelled ones may still be winding down
+    struct BulkLoad {
+        std::thread thread;
+        std::atomic<bool> cancelled{false};
+        std::atomic<bool> finished{false};
+    };
+    std::vector<std::shared_ptr<BulkLoad>> bulk_loads;
+    static constexpr int BULK_PAGE_SIZE = 200;
+    
     AudioLevels audio_levels;
     
     // Mutex to protect playback state from concurrent access
@@ -111,7 +178,7 @@ struct PlexClient::Impl {
     std::map<std::string, std::vector<LyricLine>> synced_lyrics_results;  // track_id -> time-synced lyrics
     std::map<std::string, bool> lyrics_in_progress;     // track_id -> fetching status
     bool lyrics_thread_running = false;
-    // No curl handle needed - we use subprocess (popen) for thread-safe lyrics fetching
+    // No curl handle of its own - lyrics use HttpPool handles (one transfer per handle at a time)
     
     static size_t write_callback(void* contents, size_t size, size_t nmemb, void* userp) {
         ((std::string*)userp)->append((char*)contents, size * nmemb);
@@ -162,8 +229,8 @@ struct PlexClient::Impl {
     
     // Lyrics fetching thread function
     void lyrics_thread_func() {
-        // No curl handle needed - we use subprocess (popen) for lyrics fetching
-        // This avoids all thread-safety issues with libcurl
+        // Requests go through HttpPool, which hands each transfer a handle of its
+        // own, so this thread never shares a curl handle with the UI
         
         while (lyrics_thread_running) {
             bool has_request = false;
@@ -390,52 +457,24 @@ struct PlexClient::Impl {
             
             log_lyrics_fetch("LRCLIB URL: " + lrclib_url);
             
-            // Build curl command (use curl command-line tool via subprocess)
-            // Don't use --fail so we can check the response content even on HTTP errors
-            std::string curl_cmd = "curl -s -m 10 --silent --show-error \"";
-            curl_cmd += lrclib_url;
-            curl_cmd += "\"";
-            
-            log_lyrics_fetch("Executing curl command for LRCLIB (subprocess)");
-            
-            FILE* pipe = popen(curl_cmd.c_str(), "r");
-            if (!pipe) {
-                log_lyrics_fetch("ERROR: Failed to open pipe for LRCLIB curl command");
+            // Fetch on a pooled connection (reused across lyrics lookups); an HTTP
+            // error still returns its body, which is checked below
+            log_lyrics_fetch("Fetching LRCLIB response");
+            auto shutting_down = [this]() {
+                std::lock_guard<std::mutex> lock(lyrics_mutex);
+                return !lyrics_thread_running;
+            };
+            std::string response;
+            HttpPool::instance().get(lrclib_url, {}, 10L, response, nullptr, shutting_down);
+            if (shutting_down()) {
+                log_lyrics_fetch("Thread shutdown detected during LRCLIB fetch");
                 return "";
             }
             
-            // Check for shutdown while reading
-            {
-                std::lock_guard<std::mutex> lock(lyrics_mutex);
-                if (!lyrics_thread_running) {
-                    pclose(pipe);
-                    log_lyrics_fetch("Thread shutdown detected during LRCLIB fetch");
-                    return "";
-                }
-            }
-            
-            // Read response (read all data, not just one line)
-            std::array<char, 8192> buffer;
-            std::string response;
-            size_t total_read = 0;
-            while (fgets(buffer.data(), buffer.size(), pipe) != nullptr) {
-                // Check for shutdown periodically
-                {
-                    std::lock_guard<std::mutex> lock(lyrics_mutex);
-                    if (!lyrics_thread_running) {
-                        pclose(pipe);
-                        log_lyrics_fetch("Thread shutdown detected while reading LRCLIB response");
-                        return "";
-                    }
-                }
-                size_t len = strlen(buffer.data());
-                response += buffer.data();
-                total_read += len;
-                // Safety limit: max 1MB response
-                if (total_read > 1024 * 1024) {
-                    log_lyrics_fetch("WARNING: LRCLIB response exceeds 1MB, truncating");
-                    break;
-                }
+            // Safety limit: max 1MB response
+            if (response.size() > 1024 * 1024) {
+                log_lyrics_fetch("WARNING: LRCLIB response exceeds 1MB, truncating");
+                response.resize(1024 * 1024);
             }
             
             // Remove trailing newline if present
@@ -443,8 +482,6 @@ struct PlexClient::Impl {
                 response.pop_back();
             }
             
-            pclose(pipe);  // Don't check status - check response content instead
-            
             if (response.empty()) {
                 log_lyrics_fetch("LRCLIB API returned empty response");
                 return "";
@@ -513,28 +550,6 @@ struct PlexClient::Impl {
         }
     }
     
-    // Simple URL encoding helper
-    std::string url_encode(const std::string& str) {
-        std::string encoded;
-        encoded.reserve(str.length() * 3);  // Worst case: all chars need encoding
-        
-        for (char c : str) {
-            if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || 
-                (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.' || c == '~') {
-                encoded += c;
-            } else if (c == ' ') {
-                encoded += "%20";
-            } else {
-                // URL encode special characters
-                char hex[4];
-                snprintf(hex, sizeof(hex), "%%%02X", static_cast<unsigned char>(c));
-                encoded += hex;
-            }
-        }
-        
-        return encoded;
-    }
-    
     // Simple JSON field parser (extracts value from "fieldName":"value")
     // Handles multi-line strings with escaped characters
     // Note: This function properly unescapes \n, \r, \t, etc. from JSON strings
@@ -628,105 +643,27 @@ struct PlexClient::Impl {
         log_lyrics_fetch("Starting lyrics fetch for: \"" + request.title + "\" by \"" + request.artist + "\"");
         
         try {
-            // URL encode artist and title for curl command
-            std::string encoded_artist;
-            std::string encoded_title;
-            
-            // URL encode artist and title (curl will handle it, but we need proper encoding)
-            // Use curl's built-in URL encoding via curl_easy_escape if available, or manual encoding
-            for (char c : request.artist) {
-                if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || 
-                    (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.' || c == '~') {
-                    encoded_artist += c;
-                } else if (c == ' ') {
-                    encoded_artist += "%20";
-                } else {
-                    // URL encode special characters
-                    char hex[4];
-                    snprintf(hex, sizeof(hex), "%%%02X", static_cast<unsigned char>(c));
-                    encoded_artist += hex;
-                }
-            }
-            
-            for (char c : request.title) {
-                if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || 
-                    (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.' || c == '~') {
-                    encoded_title += c;
-                } else if (c == ' ') {
-                    encoded_title += "%20";
-                } else {
-                    // URL encode special characters
-                    char hex[4];
-                    snprintf(hex, sizeof(hex), "%%%02X", static_cast<unsigned char>(c));
-                    encoded_title += hex;
-                }
-            }
-            
-            
-            std::string lyrics_url = "https://api.lyrics.ovh/v1/" + encoded_artist + "/" + encoded_title;
+            std::string lyrics_url = "https://api.lyrics.ovh/v1/" + url_encode(request.artist) + "/" +
+                                     url_encode(request.title);
             log_lyrics_fetch("URL: " + lyrics_url);
             
-            // Build curl command (use curl command-line tool via subprocess)
-            // Escape single quotes in URL for shell safety
-            std::string escaped_url = lyrics_url;
-            size_t pos = 0;
-            while ((pos = escaped_url.find("'", pos)) != std::string::npos) {
-                escaped_url.replace(pos, 1, "'\\''");
-                pos += 4;
-            }
-            
-            std::string curl_cmd = "curl -s -S --max-time 5 --connect-timeout 3 --location '";
-            curl_cmd += escaped_url;
-            curl_cmd += "' 2>/dev/null";
-            
-            log_lyrics_fetch("Executing curl command (subprocess)");
-            
-            // Use popen to execute curl command and read output
-            // This is thread-safe - each subprocess runs independently
-            FILE* pipe = popen(curl_cmd.c_str(), "r");
-            if (!pipe) {
-                log_lyrics_fetch("ERROR: Failed to start curl subprocess");
-                return "";  // Failed to start subprocess
-            }
-            
-            // Check if thread is being shut down before reading (for smooth quit)
-            {
+            // Fetch on a pooled connection (status not needed - we check response content)
+            log_lyrics_fetch("Fetching lyrics.ovh response");
+            auto shutting_down = [this]() {
                 std::lock_guard<std::mutex> lock(lyrics_mutex);
-                if (!lyrics_thread_running) {
-                    log_lyrics_fetch("Thread shutdown detected, closing pipe");
-                    pclose(pipe);  // Close pipe if shutting down
-                    return "";
-                }
-            }
-            
-            // Read response from subprocess (thread-safe - each pipe is independent)
+                return !lyrics_thread_running;
+            };
             std::string response;
-            response.reserve(8192);  // Pre-allocate
-            char buffer[4096];
-            size_t bytes_read = 0;
-            while (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
-                // Check if shutting down during read
-                {
-                    std::lock_guard<std::mutex> lock(lyrics_mutex);
-                    if (!lyrics_thread_running) {
-                        log_lyrics_fetch("Thread shutdown detected during read, closing pipe");
-                        pclose(pipe);
-                        return "";
-                    }
-                }
-                
-                size_t len = strlen(buffer);
-                if (len > 0) {
-                    response.append(buffer, len);
-                    bytes_read += len;
-                    // Safety limit: max 1MB response
-                    if (bytes_read > 1024 * 1024) {
-                        break;
-                    }
-                }
+            HttpPool::instance().get(lyrics_url, {}, 5L, response, nullptr, shutting_down);
+            if (shutting_down()) {
+                log_lyrics_fetch("Thread shutdown detected during fetch");
+                return "";
             }
             
-            pclose(pipe);  // Close pipe (status not needed - we check response content)
+            // Safety limit: max 1MB response
+            if (response.size() > 1024 * 1024) {
+                response.resize(1024 * 1024);
+            }
             
             log_lyrics_fetch("Received response: " + std::to_string(response.length()) + " bytes");
             if (response.length() > 0 && response.length() < 200) {
@@ -864,6 +801,7 @@ PlexClient::PlexClient(const std::string& server_url, const std::string& token,
     
     curl_global_init(CURL_GLOBAL_DEFAULT);
     pimpl->curl = curl_easy_init();
+    pimpl->executor = std::make_unique<HttpExecutor>();
     
     // Initialize audio decoder and album art
     audio_decoder = std::make_unique<AudioDecoder>();
@@ -877,6 +815,30 @@ PlexClient::PlexClient(const std::string& server_url, const std::string& token,
 PlexClient::~PlexClient() {
     stop_audio_capture();
     
+    // Abandon in-flight library requests (their results have nowhere to go)
+    if (pimpl) {
+        if (pimpl->library_sync) {
+            auto status = pimpl->library_sync->status();
+            log_lyrics_fetch("Library index: " + std::to_string(status.artists) + " artists, " +
+                             std::to_string(status.albums) + " albums, " + std::to_string(status.tracks) + " tracks" +
+                             (status.error.empty() ? "" : " (last sync: " + status.error + ")"));
+            pimpl->library_sync.reset();  // Its requests use this client's URL and token
+        }
+        cancel_bulk_load();
+        for (auto& load : pimpl->bulk_loads) {
+            if (load->thread.joinable()) load->thread.join();
+        }
+        pimpl->executor.reset();
+        
+        auto stats = pimpl->response_cache.stats();
+        log_lyrics_fetch("Response cache: " + std::to_string(stats.hits) + " hits, " +
+                         std::to_string(stats.misses) + " misses, " +
+                         std::to_string(stats.not_modified) + " revalidated, " +
+                         std::to_string(stats.refreshed) + " refreshed, " +
+                         std::to_string(stats.coalesced) + " coalesced, " +
+                         std::to_string(stats.entries) + " entries / " + std::to_string(stats.bytes) + " bytes");
+    }
+    
     // Stop lyrics thread cleanly
     if (pimpl) {
         log_lyrics_fetch("Shutting down lyrics thread...");
@@ -909,7 +871,7 @@ bool PlexClient::connect() {
     }
     
     // Test connection with a simple request
-    std::string response = make_request("/");
+    std::string response = make_request("/", "GET", false);
     if (response.empty() || response.length() < 10) {
         // Connection failed, but don't crash
         connected = false;
@@ -924,12 +886,36 @@ bool PlexClient::connect() {
     }
     
     connected = true;
+    machine_id = PlexXML::parse(response).get_attr("machineIdentifier");
+    
+    // Discover the music sections once per connection rather than per request;
+    // if this fails get_music_sections() tries again after SECTIONS_RETRY_AFTER
+    sections_retry_at = std::chrono::steady_clock::now();
+    if (!reload_library_sections()) {
+        sections_retry_at += SECTIONS_RETRY_AFTER;
+    }
+    
+    // Open the async executor's connection now and keep it alive while idle
+    if (pimpl->executor) {
+        pimpl->executor->keep_warm(request_url("/identity"), request_headers(), std::chrono::seconds(30));
+    }
     return true;
 }
 
-std::string PlexClient::make_request(const std::string& endpoint, const std::string& method) {
+std::string PlexClient::make_request(const std::string& endpoint, const std::string& method, bool want_json) {
     if (!pimpl || !pimpl->curl) return "";
     
+    // Library reads are answered from the response cache (checked in the background when due)
+    bool use_cache = method == "GET" && ResponseCache::cacheable(endpoint);
+    std::string key = cache_key(endpoint, want_json);
+    if (use_cache) {
+        ResponseCache::Entry cached;
+        if (pimpl->response_cache.lookup(key, cached)) {
+            revalidate(endpoint, want_json, cached, nullptr, nullptr);
+            return *cached.body;
+        }
+    }
+    
     pimpl->response_buffer.clear();
     
     std::string url = server_url + endpoint;
@@ -940,8 +926,9 @@ std::string PlexClient::make_request(const std::string& endpoint, const std::str
         url += "X-Plex-Token=" + token;
     }
     
-    // Reset curl options
+    // Reset curl options (open connections survive) and rejoin the shared caches
     curl_easy_reset(pimpl->curl);
+    HttpPool::instance().configure(pimpl->curl);
     
     curl_easy_setopt(pimpl->curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(pimpl->curl, CURLOPT_WRITEFUNCTION, Impl::write_callback);
@@ -958,9 +945,14 @@ std::string PlexClient::make_request(const std::string& endpoint, const std::str
     struct curl_slist* headers = nullptr;
     std::string token_header = "X-Plex-Token: " + token;
     headers = curl_slist_append(headers, token_header.c_str());
-    headers = curl_slist_append(headers, "Accept: application/xml");
+    headers = curl_slist_append(headers, want_json ? "Accept: application/json" : "Accept: application/xml");
     curl_easy_setopt(pimpl->curl, CURLOPT_HTTPHEADER, headers);
     
+    // Capture the validators for the response cache
+    HttpExecutor::Response validators;
+    curl_easy_setopt(pimpl->curl, CURLOPT_HEADERFUNCTION, HttpExecutor::header_callback);
+    curl_easy_setopt(pimpl->curl, CURLOPT_HEADERDATA, &validators);
+    
     if (method == "POST") {
         curl_easy_setopt(pimpl->curl, CURLOPT_POST, 1L);
     } else if (method == "PUT") {
@@ -974,16 +966,29 @@ std::string PlexClient::make_request(const std::string& endpoint, const std::str
         return "";
     }
     
+    if (use_cache && !pimpl->response_buffer.empty()) {
+        long status = 0;
+        curl_easy_getinfo(pimpl->curl, CURLINFO_RESPONSE_CODE, &status);
+        if (status >= 200 && status < 300) {
+            ResponseCache::Entry entry;
+            entry.body = std::make_shared<const std::string>(pimpl->response_buffer);
+            entry.etag = std::move(validators.etag);
+            entry.last_modified = std::move(validators.last_modified);
+            pimpl->response_cache.store(key, std::move(entry));
+        }
+    }
+    
     return pimpl->response_buffer;
 }
 
 // Real Plex API implementations
-int PlexClient::get_music_library_id() {
-    if (!connected) return -1;
+bool PlexClient::reload_library_sections() {
+    if (!connected) return false;
     
-    std::string response = make_request("/library/sections");
-    if (response.empty() || response.length() < 10) return -1;
+    std::string response = make_request("/library/sections", "GET", false);
+    if (response.empty() || response.length() < 10) return false;
     
+    std::vector<LibrarySection> sections;
     try {
         PlexXML::Node root = PlexXML::parse(response);
         auto directories = root.find_all("Directory");
@@ -993,50 +998,59 @@ int PlexClient::get_music_library_id() {
             if (type == "artist") {
                 std::string key = dir.get_attr("key", "-1");
                 if (key != "-1" && !key.empty()) {
-                    return std::stoi(key);
+                    LibrarySection section;
+                    section.id = std::stoi(key);
+                    section.title = dir.get_attr("title", "");
+                    section.agent = dir.get_attr("agent", "");
+                    sections.push_back(section);
                 }
             }
         }
     } catch (...) {
-        // XML parsing failed
-        return -1;
+        // XML parsing failed - keep whatever was cached before
+        return false;
     }
-    return -1;
+    
+    music_sections = std::move(sections);
+    sections_loaded = true;
+    return true;
+}
+
+const std::vector<PlexClient::LibrarySection>& PlexClient::get_music_sections() {
+    if (!sections_loaded && std::chrono::steady_clock::now() >= sections_retry_at &&
+        !reload_library_sections()) {
+        sections_retry_at = std::chrono::steady_clock::now() + SECTIONS_RETRY_AFTER;
+    }
+    return music_sections;
+}
+
+int PlexClient::get_music_library_id() {
+    if (!connected) return -1;
+    
+    const auto& sections = get_music_sections();
+    return sections.empty() ? -1 : sections.front().id;
+}
+
+// Query parameters for items [start, start + count) of a list
+static std::string page_params(int start, int count) {
+    return "X-Plex-Container-Start=" + std::to_string(start) + "&X-Plex-Container-Size=" + std::to_string(count);
+}
+
+std::string PlexClient::search_endpoint(int library_id, const std::string& query, int start, int count) {
+    // Use Plex server-side search API (the query must be URL encoded); pages are positional (Container-Start / -Size
+    // rather than limit, which the server applies before the offset)
+    return "/library/sections/" + std::to_string(library_id) + 
+           "/search?type=10&query=" + url_encode(query) + "&" + page_params(start, count);
 }
 
 std::vector<Track> PlexClient::search_tracks(const std::string& query, int limit, int start) {
     int lib_id = get_music_library_id();
     if (lib_id < 0) return {};
     
-    // URL encode the query for server-side search (Plex API requires URL encoding)
-    std::string encoded_query;
-    for (char c : query) {
-        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || 
-            (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.' || c == '~') {
-            encoded_query += c;
-        } else if (c == ' ') {
-            encoded_query += "%20";
-        } else {
-            // URL encode other characters
-            char hex[4];
-            snprintf(hex, sizeof(hex), "%%%02X", static_cast<unsigned char>(c));
-            encoded_query += hex;
-        }
-    }
-    
-    // Use Plex server-side search API with pagination support
-    std::string endpoint = "/library/sections/" + std::to_string(lib_id) + 
-                          "/search?type=10&query=" + encoded_query + "&limit=" + std::to_string(limit);
-    
-    // Add pagination if needed
-    if (start > 0) {
-        endpoint += "&X-Plex-Container-Start=" + std::to_string(start);
-    }
-    
-    std::string response = make_request(endpoint);
+    std::string response = make_request(search_endpoint(lib_id, query, start, limit));
     if (response.empty()) return {};
     
-    return parse_tracks_from_xml(response);
+    return parse_tracks(response);
 }
 
 std::vector<Track> PlexClient::get_tracks_from_library(int library_id, int limit) {
@@ -1045,7 +1059,7 @@ std::vector<Track> PlexClient::get_tracks_from_library(int library_id, int limit
     std::string response = make_request(endpoint);
     if (response.empty()) return {};
     
-    return parse_tracks_from_xml(response);
+    return parse_tracks(response);
 }
 
 std::vector<Track> PlexClient::get_recent_tracks(int limit) {
@@ -1057,10 +1071,10 @@ std::vector<Track> PlexClient::get_recent_tracks(int limit) {
     std::string response = make_request(endpoint);
     if (response.empty()) return {};
     
-    return parse_tracks_from_xml(response);
+    return parse_tracks(response);
 }
 
-std::vector<Track> PlexClient::get_playlist_tracks(const std::string& playlist_id, int start, int size) {
+std::string PlexClient::playlist_tracks_endpoint(const std::string& playlist_id, int start, int size) {
     std::string endpoint = "/playlists/" + playlist_id + "/items";
     
     // Add pagination parameters to URL (Plex API uses query parameters)
@@ -1073,51 +1087,88 @@ std::vector<Track> PlexClient::get_playlist_tracks(const std::string& playlist_i
         endpoint += has_params ? "&" : "?";
         endpoint += "X-Plex-Container-Size=" + std::to_string(size);
     }
-    
-    std::string response = make_request(endpoint);
+    return endpoint;
+}
+
+std::vector<Track> PlexClient::get_playlist_tracks(const std::string& playlist_id, int start, int size) {
+    std::string response = make_request(playlist_tracks_endpoint(playlist_id, start, size));
     if (response.empty()) return {};
     
-    return parse_tracks_from_xml(response);
+    return parse_tracks(response);
+}
+
+std::string PlexClient::artists_endpoint(int library_id, int start, int count) {
+    return "/library/sections/" + std::to_string(library_id) + 
+           "/all?type=8&" + page_params(start, count);
 }
 
 std::vector<PlexClient::Artist> PlexClient::get_artists(int library_id, int limit) {
-    std::string endpoint = "/library/sections/" + std::to_string(library_id) + 
-                          "/all?type=8&limit=" + std::to_string(limit);
-    std::string response = make_request(endpoint);
+    std::string response = make_request(artists_endpoint(library_id, 0, limit));
     if (response.empty()) return {};
     
+    return parse_artists(response);
+}
+
+std::vector<PlexClient::Artist> PlexClient::parse_artists(const std::string& body) {
     std::vector<Artist> artists;
-    PlexXML::Node root = PlexXML::parse(response);
+    if (PlexJSON::looks_like_json(body)) {
+        PlexJSON::parse(body)["MediaContainer"]["Metadata"].for_each_element([&](const PlexJSON::Value& item) {
+            Artist artist;
+            artist.id = item["ratingKey"].str();
+            artist.name = item["title"].str();
+            artist.art_url = absolute_art_url(item["thumb"].str());
+            artists.push_back(artist);
+            return true;
+        });
+        return artists;
+    }
+    
+    PlexXML::Node root = PlexXML::parse(body);
     auto directories = root.find_all("Directory");
     
     for (const auto& dir : directories) {
         Artist artist;
         artist.id = dir.get_attr("ratingKey");
         artist.name = dir.get_attr("title");
-        artist.art_url = dir.get_attr("thumb", "");
-        if (!artist.art_url.empty() && artist.art_url[0] != '/') {
-            artist.art_url = server_url + artist.art_url;
-        }
+        artist.art_url = absolute_art_url(dir.get_attr("thumb", ""));
         artists.push_back(artist);
     }
     
     return artists;
 }
 
-std::vector<PlexClient::Album> PlexClient::get_albums(int library_id, const std::string& artist_id, int limit) {
-    std::string endpoint;
+std::string PlexClient::albums_endpoint(int library_id, const std::string& artist_id, int start, int count) {
     if (!artist_id.empty()) {
-        endpoint = "/library/metadata/" + artist_id + "/children?type=9&limit=" + std::to_string(limit);
-    } else {
-        endpoint = "/library/sections/" + std::to_string(library_id) + 
-                  "/all?type=9&limit=" + std::to_string(limit);
+        return "/library/metadata/" + artist_id + "/children?type=9&" + page_params(start, count);
     }
-    
-    std::string response = make_request(endpoint);
+    return "/library/sections/" + std::to_string(library_id) + 
+           "/all?type=9&" + page_params(start, count);
+}
+
+std::vector<PlexClient::Album> PlexClient::get_albums(int library_id, const std::string& artist_id, int limit) {
+    std::string response = make_request(albums_endpoint(library_id, artist_id, 0, limit));
     if (response.empty()) return {};
     
+    return parse_albums(response);
+}
+
+std::vector<PlexClient::Album> PlexClient::parse_albums(const std::string& body) {
     std::vector<Album> albums;
-    PlexXML::Node root = PlexXML::parse(response);
+    if (PlexJSON::looks_like_json(body)) {
+        PlexJSON::parse(body)["MediaContainer"]["Metadata"].for_each_element([&](const PlexJSON::Value& item) {
+            Album album;
+            album.id = item["ratingKey"].str();
+            album.title = item["title"].str();
+            album.artist = item["parentTitle"].str();
+            album.year = static_cast<int>(item["year"].integer());
+            album.art_url = absolute_art_url(item["thumb"].str());
+            albums.push_back(album);
+            return true;
+        });
+        return albums;
+    }
+    
+    PlexXML::Node root = PlexXML::parse(body);
     auto directories = root.find_all("Directory");
     
     for (const auto& dir : directories) {
@@ -1126,10 +1177,7 @@ std::vector<PlexClient::Album> PlexClient::get_albums(int library_id, const std:
         album.title = dir.get_attr("title");
         album.artist = dir.get_attr("parentTitle", "");
         album.year = std::stoi(dir.get_attr("year", "0"));
-        album.art_url = dir.get_attr("thumb", "");
-        if (!album.art_url.empty() && album.art_url[0] != '/') {
-            album.art_url = server_url + album.art_url;
-        }
+        album.art_url = absolute_art_url(dir.get_attr("thumb", ""));
         albums.push_back(album);
     }
     
@@ -1143,16 +1191,35 @@ std::vector<Track> PlexClient::get_album_tracks(const std::string& album_id) {
         return {};
     }
     
-    return parse_tracks_from_xml(response);
+    return parse_tracks(response);
+}
+
+std::string PlexClient::playlists_endpoint(int start, int count) {
+    return "/playlists/all?" + page_params(start, count);
 }
 
 std::vector<PlexClient::Playlist> PlexClient::get_playlists(int limit) {
-    std::string endpoint = "/playlists/all?limit=" + std::to_string(limit);
-    std::string response = make_request(endpoint);
+    std::string response = make_request(playlists_endpoint(0, limit));
     if (response.empty()) return {};
     
+    return parse_playlists(response);
+}
+
+std::vector<PlexClient::Playlist> PlexClient::parse_playlists(const std::string& body) {
     std::vector<Playlist> playlists;
-    PlexXML::Node root = PlexXML::parse(response);
+    if (PlexJSON::looks_like_json(body)) {
+        PlexJSON::parse(body)["MediaContainer"]["Metadata"].for_each_element([&](const PlexJSON::Value& item) {
+            Playlist playlist;
+            playlist.id = item["ratingKey"].str();
+            playlist.title = item["title"].str();
+            playlist.count = static_cast<int>(item["leafCount"].integer());
+            playlists.push_back(playlist);
+            return true;
+        });
+        return playlists;
+    }
+    
+    PlexXML::Node root = PlexXML::parse(body);
     auto directories = root.find_all("Playlist");
     
     for (const auto& pl : directories) {
@@ -1166,6 +1233,442 @@ std::vector<PlexClient::Playlist> PlexClient::get_playlists(int limit) {
     return playlists;
 }
 
+template <typename T, std::vector<T> (PlexClient::*parse)(const std::string&)>
+PlexClient::Page<T> PlexClient::parse_page(const std::string& body) {
+    Page<T> page;
+    page.items = (this->*parse)(body);
+    page.total = container_total(body);
+    page.ok = true;
+    return page;
+}
+
+int PlexClient::container_total(const std::string& body) {
+    if (PlexJSON::looks_like_json(body)) {
+        PlexJSON::Value total = PlexJSON::parse(body)["MediaContainer"]["totalSize"];
+        return total.exists() ? static_cast<int>(total.integer()) : -1;
+    }
+    std::string total = PlexXML::parse(body).get_attr("totalSize");
+    return total.empty() ? -1 : std::atoi(total.c_str());
+}
+
+std::string PlexClient::request_url(const std::string& endpoint) const {
+    std::string url = server_url + endpoint;
+    url += (url.find('?') != std::string::npos ? "&" : "?");
+    url += "X-Plex-Token=" + token;
+    return url;
+}
+
+std::vector<std::string> PlexClient::request_headers(bool want_json) const {
+    return {"X-Plex-Token: " + token, want_json ? "Accept: application/json" : "Accept: application/xml"};
+}
+
+std::string PlexClient::cache_key(const std::string& endpoint, bool want_json) {
+    return (want_json ? "json " : "xml ") + endpoint;
+}
+
+void PlexClient::revalidate(const std::string& endpoint, bool want_json, const ResponseCache::Entry& cached,
+                            CacheParser parse, const std::type_info* type) {
+    HttpExecutor* executor = pimpl ? pimpl->executor.get() : nullptr;
+    if (!executor) return;
+    ResponseCache* cache = &pimpl->response_cache;
+    std::string key = cache_key(endpoint, want_json);
+    if (!cache->begin_revalidation(key, cached)) return;  // Fresh, or already being checked
+    
+    std::vector<std::string> headers = request_headers(want_json);
+    if (!cached.etag.empty()) headers.push_back("If-None-Match: " + cached.etag);
+    if (!cached.last_modified.empty()) headers.push_back("If-Modified-Since: " + cached.last_modified);
+    
+    // Not cancellable by callers (the id is not handed out), so finish_revalidation always runs
+    executor->submit(request_url(endpoint), std::move(headers),
+        [cache, key, old_body = cached.body, parse = std::move(parse), type](HttpExecutor::Response& response) {
+            if (response.status == 304 || (response.ok && response.body == *old_body)) {
+                cache->mark_validated(key);
+            } else if (response.ok && !response.body.empty()) {
+                ResponseCache::Entry fresh;
+                fresh.body = std::make_shared<const std::string>(std::move(response.body));
+                fresh.etag = std::move(response.etag);
+                fresh.last_modified = std::move(response.last_modified);
+                if (parse) {
+                    try {
+                        fresh.parsed = parse(*fresh.body);
+                        fresh.parsed_type = type;
+                    } catch (...) {
+                        // Parsed again on next use
+                    }
+                }
+                cache->store(key, std::move(fresh));
+            }
+            cache->finish_revalidation(key);
+        });
+}
+
+template <typename T>
+uint64_t PlexClient::request_async(const std::string& endpoint, T (PlexClient::*parse)(const std::string&),
+                                   std::function<void(T)> done) {
+    HttpExecutor* executor = pimpl ? pimpl->executor.get() : nullptr;
+    if (!executor) {
+        done(T());
+        return 0;
+    }
+    
+    auto parse_body = [this, parse](const std::string& body) {
+        try {
+            return (this->*parse)(body);
+        } catch (...) {
+            return T();
+        }
+    };
+    auto deliver = [](std::function<void(T)> done) {
+        return [done = std::move(done)](const std::shared_ptr<const void>& value) {
+            done(*std::static_pointer_cast<const T>(value));
+        };
+    };
+    
+    // Already asked for: share that answer (and its parse)
+    std::string key = endpoint + '\n' + typeid(T).name();
+    auto flight = pimpl->flights.find(key);
+    if (flight != pimpl->flights.end()) {
+        uint64_t id = pimpl->next_request_id++;
+        flight->second.waiters.emplace_back(id, deliver(std::move(done)));
+        pimpl->flight_of.emplace(id, key);
+        pimpl->response_cache.count_coalesced();
+        return id;
+    }
+    
+    // Cache hit: deliver on the next UI loop pass (never from inside this call, so
+    // callers can store the returned id first), then check it in the background
+    bool use_cache = ResponseCache::cacheable(endpoint);
+    std::string stored_as = cache_key(endpoint, true);
+    ResponseCache::Entry cached;
+    if (use_cache && pimpl->response_cache.lookup(stored_as, cached)) {
+        std::shared_ptr<const T> value;
+        if (cached.parsed && cached.parsed_type && *cached.parsed_type == typeid(T)) {
+            value = std::static_pointer_cast<const T>(cached.parsed);
+        } else {
+            value = std::make_shared<const T>(parse_body(*cached.body));  // Cached by a synchronous call
+            pimpl->response_cache.set_parsed(stored_as, cached.body, value, typeid(T));
+        }
+        executor->post([done = std::move(done), value]() { done(*value); });
+        revalidate(endpoint, true, cached, [parse_body](const std::string& body) -> std::shared_ptr<const void> {
+            return std::make_shared<const T>(parse_body(body));
+        }, &typeid(T));
+        return 0;
+    }
+    
+    ResponseCache* cache = use_cache ? &pimpl->response_cache : nullptr;
+    Impl* impl = pimpl.get();
+    uint64_t id = pimpl->next_request_id++;
+    Impl::Flight& started = pimpl->flights[key];
+    started.serial = id;
+    started.waiters.emplace_back(id, deliver(std::move(done)));
+    pimpl->flight_of.emplace(id, key);
+    started.transfer = executor->submit(request_url(endpoint), request_headers(),
+        [executor, impl, cache, stored_as, key, serial = id, parse_body](HttpExecutor::Response& response) {
+            // Parse here on the I/O thread; only the finished value crosses to the UI
+            auto result = std::make_shared<const T>();
+            if (response.ok && !response.body.empty()) {
+                result = std::make_shared<const T>(parse_body(response.body));
+                if (cache) {
+                    ResponseCache::Entry entry;
+                    entry.body = std::make_shared<const std::string>(std::move(response.body));
+                    entry.etag = std::move(response.etag);
+                    entry.last_modified = std::move(response.last_modified);
+                    entry.parsed = result;
+                    entry.parsed_type = &typeid(T);
+                    cache->store(stored_as, std::move(entry));
+                }
+            }
+            executor->post([impl, key, serial, result]() { impl->finish_flight(key, serial, result); });
+        });
+    return id;
+}
+
+template <typename T>
+uint64_t PlexClient::post_result(T value, std::function<void(T)> done) {
+    HttpExecutor* executor = pimpl ? pimpl->executor.get() : nullptr;
+    if (!executor) {
+        done(std::move(value));
+        return 0;
+    }
+    auto result = std::make_shared<T>(std::move(value));
+    executor->post([done = std::move(done), result]() { done(std::move(*result)); });
+    return 0;
+}
+
+uint64_t PlexClient::get_artists_async(int library_id, int start, int count, std::function<void(Page<Artist>)> done) {
+    if (auto index = local_index(library_id)) {
+        Page<Artist> page;
+        size_t total = index->count(LibraryIndex::Kind::Artist);
+        for (size_t i = static_cast<size_t>(start); i < std::min(total, static_cast<size_t>(start + count)); ++i) {
+            page.items.push_back(artist_from_item(index->item(LibraryIndex::Kind::Artist, i)));
+        }
+        page.total = static_cast<int>(total);
+        page.ok = true;
+        return post_result(std::move(page), std::move(done));
+    }
+    return request_async(artists_endpoint(library_id, start, count),
+                         &PlexClient::parse_page<Artist, &PlexClient::parse_artists>, std::move(done));
+}
+
+uint64_t PlexClient::get_albums_async(int library_id, const std::string& artist_id, int start, int count,
+                                      std::function<void(Page<Album>)> done) {
+    if (auto index = local_index(library_id)) {
+        // The library-wide list in title order, or the artist's albums
+        LibraryIndex::Range range{0, index->count(LibraryIndex::Kind::Album)};
+        if (!artist_id.empty()) {
+            size_t artist = index->find(LibraryIndex::Kind::Artist, artist_id);
+            range = index->children(LibraryIndex::Kind::Artist, artist);
+        }
+        // An artist not in the snapshot (yet) is asked of the server
+        if (artist_id.empty() || range.count > 0) {
+            Page<Album> page;
+            for (size_t i = static_cast<size_t>(start); i < std::min(range.count, static_cast<size_t>(start + count)); ++i) {
+                size_t album = artist_id.empty() ? index->album_by_title(i) : range.first + i;
+                page.items.push_back(album_from_item(index->item(LibraryIndex::Kind::Album, album)));
+            }
+            page.total = static_cast<int>(range.count);
+            page.ok = true;
+            return post_result(std::move(page), std::move(done));
+        }
+    }
+    return request_async(albums_endpoint(library_id, artist_id, start, count),
+                         &PlexClient::parse_page<Album, &PlexClient::parse_albums>, std::move(done));
+}
+
+uint64_t PlexClient::get_album_tracks_async(const std::string& album_id, std::function<void(std::vector<Track>)> done) {
+    if (auto index = local_index(-1)) {
+        size_t album = index->find(LibraryIndex::Kind::Album, album_id);
+        LibraryIndex::Range range = index->children(LibraryIndex::Kind::Album, album);
+        if (range.count > 0) {
+            std::vector<Track> tracks;
+            tracks.reserve(range.count);
+            for (size_t i = range.first; i < range.first + range.count; ++i) {
+                tracks.push_back(track_from_item(index->item(LibraryIndex::Kind::Track, i)));
+            }
+            return post_result(std::move(tracks), std::move(done));
+        }
+    }
+    return request_async("/library/metadata/" + album_id + "/children", &PlexClient::parse_tracks,
+                         std::move(done));
+}
+
+uint64_t PlexClient::get_playlists_async(int start, int count, std::function<void(Page<Playlist>)> done) {
+    return request_async(playlists_endpoint(start, count),
+                         &PlexClient::parse_page<Playlist, &PlexClient::parse_playlists>, std::move(done));
+}
+
+uint64_t PlexClient::get_playlist_tracks_async(const std::string& playlist_id, int start, int count,
+                                               std::function<void(Page<Track>)> done) {
+    return request_async(playlist_tracks_endpoint(playlist_id, start, count),
+                         &PlexClient::parse_page<Track, &PlexClient::parse_tracks>, std::move(done));
+}
+
+uint64_t PlexClient::search_tracks_async(int library_id, const std::string& query, int start, int count,
+                                         std::function<void(Page<Track>)> done) {
+    if (auto search = local_search(library_id)) {
+        // Pages are slices of one ranked result list
+        auto& cache = pimpl->search_cache;
+        if (!cache || cache->index() != search) {
+            cache = std::make_unique<SearchCache>(search);
+        }
+        size_t total = 0;
+        std::vector<size_t> hits = cache->search(query, static_cast<size_t>(start + count), &total);
+        Page<Track> page;
+        for (size_t i = static_cast<size_t>(start); i < hits.size(); ++i) {
+            page.items.push_back(track_from_item(search->library().item(LibraryIndex::Kind::Track, hits[i])));
+        }
+        page.total = static_cast<int>(total);
+        page.ok = true;
+        return post_result(std::move(page), std::move(done));
+    }
+    return request_async(search_endpoint(library_id, query, start, count),
+                         &PlexClient::parse_page<Track, &PlexClient::parse_tracks>, std::move(done));
+}
+
+void PlexClient::cancel_request(uint64_t id) {
+    if (!pimpl || !pimpl->executor || id == 0) return;
+    auto caller = pimpl->flight_of.find(id);
+    if (caller == pimpl->flight_of.end()) return;  // Already answered
+    auto flight = pimpl->flights.find(caller->second);
+    pimpl->flight_of.erase(caller);
+    if (flight == pimpl->flights.end()) return;
+    
+    auto& waiters = flight->second.waiters;
+    waiters.erase(std::remove_if(waiters.begin(), waiters.end(),
+                                 [id](const auto& waiter) { return waiter.first == id; }),
+                  waiters.end());
+    if (waiters.empty()) {
+        pimpl->orphaned.emplace_back(flight->first, flight->second.serial);
+    }
+}
+
+void PlexClient::load_playlist_tracks_async(const std::string& playlist_id, int total,
+                                            std::function<void(Page<Track>)> on_page,
+                                            std::function<void(bool)> done) {
+    HttpExecutor* executor = pimpl ? pimpl->executor.get() : nullptr;
+    if (!executor) {
+        done(false);
+        return;
+    }
+    cancel_bulk_load();
+    auto& loads = pimpl->bulk_loads;
+    loads.erase(std::remove_if(loads.begin(), loads.end(), [](const auto& load) {
+        if (!load->finished) return false;
+        load->thread.join();
+        return true;
+    }), loads.end());
+    
+    auto load = std::make_shared<Impl::BulkLoad>();
+    loads.push_back(load);
+    load->thread = std::thread([this, executor, load, playlist_id, total,
+                                on_page = std::move(on_page), done = std::move(done)]() {
+        PageFetcher pages([this, &playlist_id](size_t start, size_t count, std::string& body,
+                                               const std::function<bool()>& abort) {
+            long status = 0;
+            return HttpPool::instance().get(request_url(playlist_tracks_endpoint(playlist_id, static_cast<int>(start),
+                                                                                 static_cast<int>(count))),
+                                            request_headers(), 30L, body, &status, abort, false) &&
+                   status == 200;
+        }, Impl::BULK_PAGE_SIZE, parallel_pages);
+        
+        // Parsed here; each page crosses to the UI thread as soon as it is next in line
+        bool ok = pages.run(total < 0 ? PageFetcher::npos : static_cast<size_t>(total),
+            [&](std::string& body, size_t& list_total) {
+                auto page = std::make_shared<Page<Track>>(parse_page<Track, &PlexClient::parse_tracks>(body));
+                if (page->total >= 0) list_total = static_cast<size_t>(page->total);
+                size_t received = page->items.size();
+                executor->post([load, on_page, page]() {
+                    if (!load->cancelled) on_page(std::move(*page));
+                });
+                return received;
+            },
+            [&load] { return load->cancelled.load(); });
+        executor->post([load, done, ok]() {
+            if (!load->cancelled) done(ok);
+        });
+        load->finished = true;
+    });
+}
+
+void PlexClient::cancel_bulk_load() {
+    if (!pimpl) return;
+    for (auto& load : pimpl->bulk_loads) {
+        load->cancelled = true;
+    }
+}
+
+void PlexClient::set_parallel_pages(int count) {
+    parallel_pages = std::clamp(count, 1, PageFetcher::MAX_PARALLEL);
+}
+
+void PlexClient::run_async_completions() {
+    if (pimpl && pimpl->executor) {
+        // Nobody asked again for what every caller cancelled: stop those transfers
+        for (const auto& [key, serial] : pimpl->orphaned) {
+            auto flight = pimpl->flights.find(key);
+            if (flight != pimpl->flights.end() && flight->second.serial == serial && flight->second.waiters.empty()) {
+                pimpl->executor->cancel(flight->second.transfer);
+                pimpl->flights.erase(flight);
+            }
+        }
+        pimpl->orphaned.clear();
+        pimpl->executor->run_completions();
+    }
+}
+
+ResponseCache::Stats PlexClient::get_response_cache_stats() const {
+    return pimpl ? pimpl->response_cache.stats() : ResponseCache::Stats();
+}
+
+void PlexClient::start_library_sync(const std::string& directory) {
+    if (!pimpl || pimpl->library_sync || !connected || directory.empty()) return;
+    int library_id = get_music_library_id();
+    if (library_id < 0) return;
+    
+    // One snapshot per server and section; the machine id survives URL changes
+    std::string name = machine_id.empty() ? server_url : machine_id;
+    for (char& c : name) {
+        if (!isalnum(static_cast<unsigned char>(c)) && c != '-') c = '_';
+    }
+    std::string path = directory + "/" + name + "-" + std::to_string(library_id) + ".idx";
+    
+    pimpl->library_sync = std::make_unique<LibrarySync>(path, library_id,
+        [this](const std::string& endpoint, std::string& body, const std::function<bool()>& abort) {
+            long status = 0;
+            return HttpPool::instance().get(request_url(endpoint), request_headers(), 120L, body, &status, abort,
+                                            false) &&
+                   status == 200;
+        }, parallel_pages);
+    pimpl->library_sync->start();
+}
+
+std::shared_ptr<const LibraryIndex> PlexClient::get_library_index() const {
+    return pimpl && pimpl->library_sync ? pimpl->library_sync->index() : nullptr;
+}
+
+uint64_t PlexClient::get_library_index_version() const {
+    return pimpl && pimpl->library_sync ? pimpl->library_sync->version() : 0;
+}
+
+LibrarySync::Status PlexClient::get_library_sync_status() const {
+    return pimpl && pimpl->library_sync ? pimpl->library_sync->status() : LibrarySync::Status();
+}
+
+std::shared_ptr<const LibraryIndex> PlexClient::local_index(int library_id) const {
+    if (!pimpl || !pimpl->library_sync) return nullptr;
+    if (library_id >= 0 && library_id != pimpl->library_sync->section_id()) return nullptr;
+    return pimpl->library_sync->index();
+}
+
+std::shared_ptr<const SearchIndex> PlexClient::local_search(int library_id) const {
+    if (!pimpl || !pimpl->library_sync) return nullptr;
+    if (library_id >= 0 && library_id != pimpl->library_sync->section_id()) return nullptr;
+    return pimpl->library_sync->search_index();
+}
+
+bool PlexClient::has_local_search(int library_id) const {
+    return local_search(library_id) != nullptr;
+}
+
+PlexClient::Artist PlexClient::artist_from_item(const LibraryIndex::Item& item) const {
+    Artist artist;
+    artist.id = item.id;
+    artist.name = item.title;
+    artist.art_url = absolute_art_url(item.thumb);
+    return artist;
+}
+
+PlexClient::Album PlexClient::album_from_item(const LibraryIndex::Item& item) const {
+    Album album;
+    album.id = item.id;
+    album.title = item.title;
+    album.artist = item.artist;
+    album.year = item.year;
+    album.art_url = absolute_art_url(item.thumb);
+    return album;
+}
+
+Track PlexClient::track_from_item(const LibraryIndex::Item& item) const {
+    Track track;
+    track.id = item.id;
+    track.title = item.title;
+    track.artist = item.artist;
+    track.album = item.album;
+    track.duration_ms = item.duration_ms;
+    track.year = item.year;
+    track.genre = item.genre;
+    track.bitrate = item.bitrate;
+    track.codec = item.codec;
+    track.media_url = media_url_for_part(item.part_key);
+    track.thumb_url = absolute_art_url(item.thumb);
+    track.art_url = absolute_art_url(item.art);
+    return track;
+}
+
+int PlexClient::async_wake_fd() const {
+    return pimpl && pimpl->executor ? pimpl->executor->wake_fd() : -1;
+}
+
 // Helper to parse tracks from XML
 std::vector<Track> PlexClient::parse_tracks_from_xml(const std::string& xml) {
     std::vector<Track> tracks;
@@ -1222,9 +1725,7 @@ std::vector<Track> PlexClient::parse_tracks_from_xml(const std::string& xml) {
                         // "lyric" = alternative field name
                         // Plex Pass users may have time-synced lyrics from LyricFind
                         // Note: Plex Web uses LyricFind for time-synced lyrics, which may not be in local LRC files
-                        if (field_type == "lyrics" || field_type == "lyric" || 
-                            field_type == "lyricsTimed" || field_type == "lyrics_timed" ||
-                            field_type == "lyricsSynced" || field_type == "lyrics_synced") {
+                        if (is_lyrics_field(field_type)) {
                             track.lyrics = field_value;
                             log_lyrics_fetch("Found lyrics in Field type: " + field_type + " (" + std::to_string(field_value.length()) + " chars)");
                             // Check if it looks like time-synced format (contains [timestamp] patterns)
@@ -1253,17 +1754,7 @@ std::vector<Track> PlexClient::parse_tracks_from_xml(const std::string& xml) {
                         // Get part for media URL and file path
                         auto part = media.find_first("Part");
                         if (!part.name.empty()) {
-                            std::string key = part.get_attr("key", "");
-                            if (!key.empty() && !server_url.empty() && !token.empty()) {
-                                // Build proper Plex media URL with token
-                                track.media_url = server_url + key;
-                                // Add token parameter
-                                if (track.media_url.find('?') != std::string::npos) {
-                                    track.media_url += "&X-Plex-Token=" + token;
-                                } else {
-                                    track.media_url += "?X-Plex-Token=" + token;
-                                }
-                            }
+                            track.media_url = media_url_for_part(part.get_attr("key", ""));
                             // Note: File path extraction removed - server-side paths are not accessible from client
                         }
                     }
@@ -1273,14 +1764,8 @@ std::vector<Track> PlexClient::parse_tracks_from_xml(const std::string& xml) {
                 
                 // Get art URLs
                 try {
-                    track.thumb_url = node.get_attr("thumb", "");
-                    track.art_url = node.get_attr("art", "");
-                    if (!track.thumb_url.empty() && track.thumb_url[0] != '/' && !server_url.empty()) {
-                        track.thumb_url = server_url + track.thumb_url;
-                    }
-                    if (!track.art_url.empty() && track.art_url[0] != '/' && !server_url.empty()) {
-                        track.art_url = server_url + track.art_url;
-                    }
+                    track.thumb_url = absolute_art_url(node.get_attr("thumb", ""));
+                    track.art_url = absolute_art_url(node.get_attr("art", ""));
                 } catch (...) {
                     // Ignore art URL errors
                 }
@@ -1302,6 +1787,89 @@ std::vector<Track> PlexClient::parse_tracks_from_xml(const std::string& xml) {
     return tracks;
 }
 
+// Helper to parse tracks from a JSON MediaContainer. Each item is read in one
+// pass over its members; anything not needed is skipped without being parsed.
+std::vector<Track> PlexClient::parse_tracks_from_json(const std::string& json) {
+    std::vector<Track> tracks;
+    PlexJSON::Value items = PlexJSON::parse(json)["MediaContainer"]["Metadata"];
+    
+    items.for_each_element([&](const PlexJSON::Value& item) {
+        Track track;
+        bool is_track = true;
+        std::string part_key;
+        item.for_each_member([&](std::string_view key, const PlexJSON::Value& value) {
+            if (key == "type") {
+                is_track = value.str() == "track";
+            } else if (key == "ratingKey") {
+                track.id = value.str();
+            } else if (key == "title") {
+                track.title = value.str();
+            } else if (key == "grandparentTitle") {
+                track.artist = value.str();
+            } else if (key == "parentTitle") {
+                track.album = value.str();
+            } else if (key == "duration") {
+                track.duration_ms = static_cast<int>(value.integer());
+            } else if (key == "year") {
+                track.year = static_cast<int>(value.integer());
+            } else if (key == "genre") {
+                track.genre = value.str();
+            } else if (key == "thumb") {
+                track.thumb_url = absolute_art_url(value.str());
+            } else if (key == "art") {
+                track.art_url = absolute_art_url(value.str());
+            } else if (key == "Field") {
+                value.for_each_element([&](const PlexJSON::Value& field) {
+                    std::string field_type = field["type"].str();
+                    if (!is_lyrics_field(field_type)) return true;
+                    track.lyrics = field["value"].str();
+                    log_lyrics_fetch("Found lyrics in Field type: " + field_type + " (" + std::to_string(track.lyrics.length()) + " chars)");
+                    return false;
+                });
+            } else if (key == "Media") {
+                PlexJSON::Value media = value[0];
+                track.bitrate = static_cast<int>(media["bitrate"].integer());
+                track.codec = media["audioCodec"].str();
+                part_key = media["Part"][0]["key"].str();
+            }
+            return is_track;
+        });
+        
+        if (is_track && !track.id.empty()) {
+            track.media_url = media_url_for_part(part_key);
+            tracks.push_back(std::move(track));
+        }
+        return true;
+    });
+    
+    return tracks;
+}
+
+// Library responses are JSON unless the server ignored the Accept header
+std::vector<Track> PlexClient::parse_tracks(const std::string& body) {
+    if (PlexJSON::looks_like_json(body)) {
+        return parse_tracks_from_json(body);
+    }
+    return parse_tracks_from_xml(body);
+}
+
+std::string PlexClient::media_url_for_part(const std::string& part_key) const {
+    if (part_key.empty() || server_url.empty() || token.empty()) {
+        return "";
+    }
+    // Build proper Plex media URL with token
+    std::string url = server_url + part_key;
+    url += (url.find('?') != std::string::npos ? "&X-Plex-Token=" : "?X-Plex-Token=") + token;
+    return url;
+}
+
+std::string PlexClient::absolute_art_url(const std::string& url) const {
+    if (!url.empty() && url[0] != '/' && !server_url.empty()) {
+        return server_url + url;
+    }
+    return url;
+}
+
 bool PlexClient::play_track(const Track& track) {
     if (!pimpl) return false;
     
@@ -1657,7 +2225,7 @@ Track PlexClient::get_track_metadata(const std::string& track_id) {
     }
     
     // Parse the track from XML
-    auto tracks = parse_tracks_from_xml(response);
+    auto tracks = parse_tracks(response);
     if (!tracks.empty()) {
         return tracks[0];
     }
@@ -1673,151 +2241,42 @@ PlexClient::MusicBrainzData PlexClient::get_musicbrainz_data(const std::string&
         return data;
     }
     
-    // MusicBrainz API requires a User-Agent string
-    // Use curl to fetch JSON data
-    CURL* curl = curl_easy_init();
-    if (!curl) return data;
-    
     // Build search query - search for release by artist and title
     std::string query = "artist:\"" + artist_name + "\" AND release:\"" + album_title + "\"";
     // URL encode the query
-    char* encoded = curl_easy_escape(curl, query.c_str(), query.length());
+    char* encoded = curl_easy_escape(nullptr, query.c_str(), static_cast<int>(query.length()));
     if (!encoded) {
-        curl_easy_cleanup(curl);
         return data;
     }
     
     std::string url = "https://musicbrainz.org/ws/2/release/?query=" + std::string(encoded) + "&fmt=json&limit=1";
     curl_free(encoded);
     
+    // MusicBrainz API requires a User-Agent string; pooled connection, 5 second timeout
     std::string response;
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, [](char* ptr, size_t size, size_t nmemb, std::string* data) {
-        if (data && ptr && size > 0 && nmemb > 0) {
-            data->append(ptr, size * nmemb);
-            return size * nmemb;
-        }
-        return static_cast<size_t>(0);
-    });
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, "plex-tui/1.0 (https://github.com/user/plex-tui)");
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 5L);  // 5 second timeout
-    
-    CURLcode res = curl_easy_perform(curl);
-    curl_easy_cleanup(curl);
+    bool ok = HttpPool::instance().get(url, {"User-Agent: plex-tui/1.0 (https://github.com/user/plex-tui)"},
+                                       5L, response);
     
-    if (res != CURLE_OK || response.empty()) {
+    if (!ok || response.empty()) {
         return data;
     }
     
-    // Simple JSON parsing - look for release date, label, etc.
-    // This is a basic parser - for production, use a proper JSON library
-    try {
-        // Find "date" field
-        size_t date_pos = response.find("\"date\":");
-        if (date_pos != std::string::npos && date_pos + 7 < response.length() && date_pos < response.length()) {
-            size_t date_start = response.find("\"", date_pos + 7);
-            if (date_start != std::string::npos && date_start + 1 < response.length() && date_start < response.length()) {
-                date_start += 1;  // Skip the opening quote
-                size_t date_end = response.find("\"", date_start);
-                if (date_end != std::string::npos && date_end > date_start && date_end <= response.length() && date_start < response.length()) {
-                    size_t date_len = date_end - date_start;
-                    if (date_start + date_len <= response.length()) {
-                        data.release_date = response.substr(date_start, date_len);
-                    }
-                }
-            }
-        }
-        
-        // Find "label-info" -> "label" -> "name"
-        size_t label_pos = response.find("\"label-info\"");
-        if (label_pos != std::string::npos && label_pos < response.length()) {
-            size_t name_pos = response.find("\"name\":", label_pos);
-            if (name_pos != std::string::npos && name_pos + 7 < response.length() && name_pos < response.length()) {
-                size_t name_start = response.find("\"", name_pos + 7);
-                if (name_start != std::string::npos && name_start + 1 < response.length() && name_start < response.length()) {
-                    name_start += 1;  // Skip the opening quote
-                    size_t name_end = response.find("\"", name_start);
-                    if (name_end != std::string::npos && name_end > name_start && name_end <= response.length() && name_start < response.length()) {
-                        size_t name_len = name_end - name_start;
-                        if (name_start + name_len <= response.length()) {
-                            data.label = response.substr(name_start, name_len);
-                        }
-                    }
-                }
-            }
-        }
-        
-        // Find "country"
-        size_t country_pos = response.find("\"country\":");
-        if (country_pos != std::string::npos && country_pos + 10 < response.length() && country_pos < response.length()) {
-            size_t country_start = response.find("\"", country_pos + 10);
-            if (country_start != std::string::npos && country_start + 1 < response.length() && country_start < response.length()) {
-                country_start += 1;  // Skip the opening quote
-                size_t country_end = response.find("\"", country_start);
-                if (country_end != std::string::npos && country_end > country_start && country_end <= response.length() && country_start < response.length()) {
-                    size_t country_len = country_end - country_start;
-                    if (country_start + country_len <= response.length()) {
-                        data.country = response.substr(country_start, country_len);
-                    }
-                }
-            }
-        }
-        
-        // Find "format"
-        size_t format_pos = response.find("\"format\":");
-        if (format_pos != std::string::npos && format_pos + 8 < response.length() && format_pos < response.length()) {
-            size_t format_start = response.find("\"", format_pos + 8);
-            if (format_start != std::string::npos && format_start + 1 < response.length() && format_start < response.length()) {
-                format_start += 1;  // Skip the opening quote
-                size_t format_end = response.find("\"", format_start);
-                if (format_end != std::string::npos && format_end > format_start && format_end <= response.length() && format_start < response.length()) {
-                    size_t format_len = format_end - format_start;
-                    if (format_start + format_len <= response.length()) {
-                        data.format = response.substr(format_start, format_len);
-                    }
-                }
-            }
-        }
-        
-        // Find "barcode"
-        size_t barcode_pos = response.find("\"barcode\":");
-        if (barcode_pos != std::string::npos && barcode_pos + 11 < response.length() && barcode_pos < response.length()) {
-            size_t barcode_start = response.find("\"", barcode_pos + 11);
-            if (barcode_start != std::string::npos && barcode_start + 1 < response.length() && barcode_start < response.length()) {
-                barcode_start += 1;  // Skip the opening quote
-                size_t barcode_end = response.find("\"", barcode_start);
-                if (barcode_end != std::string::npos && barcode_end > barcode_start && barcode_end <= response.length() && barcode_start < response.length()) {
-                    size_t barcode_len = barcode_end - barcode_start;
-                    if (barcode_start + barcode_len <= response.length()) {
-                        data.barcode = response.substr(barcode_start, barcode_len);
-                    }
-                }
-            }
-        }
-        
-        // Find "disambiguation"
-        size_t disambig_pos = response.find("\"disambiguation\":");
-        if (disambig_pos != std::string::npos && disambig_pos + 17 < response.length() && disambig_pos < response.length()) {
-            size_t disambig_start = response.find("\"", disambig_pos + 17);
-            if (disambig_start != std::string::npos && disambig_start + 1 < response.length() && disambig_start < response.length()) {
-                disambig_start += 1;  // Skip the opening quote
-                size_t disambig_end = response.find("\"", disambig_start);
-                if (disambig_end != std::string::npos && disambig_end > disambig_start && disambig_end <= response.length() && disambig_start < response.length()) {
-                    size_t disambig_len = disambig_end - disambig_start;
-                    if (disambig_start + disambig_len <= response.length()) {
-                        data.disambiguation = response.substr(disambig_start, disambig_len);
-                    }
-                }
-            }
-        }
-        
-        data.valid = true;
-    } catch (...) {
-        // JSON parsing failed - return empty data
-        data.valid = false;
+    // Only the best match is requested; read its fields where they actually live
+    // (a plain text search would pick up e.g. a track's "date" or the label's "name")
+    PlexJSON::Value root = PlexJSON::parse(response);
+    PlexJSON::Value release = root["releases"][0];
+    if (!release.is_object()) {
+        return data;
     }
     
+    data.release_date = release["date"].str();
+    data.country = release["country"].str();
+    data.label = release["label-info"][0]["label"]["name"].str();
+    data.format = release["media"][0]["format"].str();
+    data.barcode = release["barcode"].str();
+    data.disambiguation = release["disambiguation"].str();
+    data.valid = true;
+    
     return data;
 }
 
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "types.h"
+#include "response_cache.h"
+#include "library_sync.h"
 #include <vector>
 #include <string>
 #include <functional>
 #include <memory>
+#include <chrono>
 
 namespace PlexTUI {
 
@@ -29,8 +32,15 @@ public:
     std::vector<Track> get_recent_tracks(int limit = 50);
     std::vector<Track> get_playlist_tracks(const std::string& playlist_id, int start = 0, int size = 100);
     
-    // Library sections
-    int get_music_library_id();  // Returns library section ID
+    // Library sections (discovered at connect() and cached for the connection)
+    struct LibrarySection {
+        int id = -1;
+        std::string title;
+        std::string agent;
+    };
+    int get_music_library_id();  // Returns library section ID (first music section)
+    const std::vector<LibrarySection>& get_music_sections();
+    bool reload_library_sections();  // Re-read /library/sections (e.g. after a library was added)
     std::vector<Track> get_tracks_from_library(int library_id, int limit = 100);
     
     // Artists, Albums, Playlists
@@ -71,6 +81,60 @@ public:
     std::vector<Track> get_album_tracks(const std::string& album_id);
     std::vector<Playlist> get_playlists(int limit = 50);
     
+    // Items [start, start + count) of a longer list, and the whole list's length
+    // (totalSize; -1 when the server doesn't report it). A failed request (timeout,
+    // HTTP error, unreadable body) delivers a Page with ok false.
+    template <typename T>
+    struct Page {
+        std::vector<T> items;
+        int total = -1;
+        bool ok = false;
+    };
+    
+    // Asynchronous versions (curl multi on an I/O thread): the request returns at
+    // once and `done` runs later on the UI thread, from run_async_completions(),
+    // with the parsed result (empty on failure). The id can cancel the request.
+    // Lists come a page at a time (X-Plex-Container-Start / -Size; see VirtualList).
+    // With a synced local library, browsing and search are answered from it.
+    uint64_t get_artists_async(int library_id, int start, int count, std::function<void(Page<Artist>)> done);
+    uint64_t get_albums_async(int library_id, const std::string& artist_id, int start, int count,
+                              std::function<void(Page<Album>)> done);
+    uint64_t get_album_tracks_async(const std::string& album_id, std::function<void(std::vector<Track>)> done);
+    uint64_t get_playlists_async(int start, int count, std::function<void(Page<Playlist>)> done);
+    uint64_t get_playlist_tracks_async(const std::string& playlist_id, int start, int count,
+                                       std::function<void(Page<Track>)> done);
+    uint64_t search_tracks_async(int library_id, const std::string& query, int start, int count,
+                                 std::function<void(Page<Track>)> done);
+    void cancel_request(uint64_t id);
+    
+    // Every track of a playlist (e.g. to shuffle it), several pages at a time over
+    // pooled connections (PageFetcher): on_page gets each page in list order on the
+    // UI thread, then done(ok). total is the track count if known (-1 if not).
+    // One bulk load runs at a time; starting another or cancel_bulk_load() stops
+    // the current one, whose callbacks then never run.
+    void load_playlist_tracks_async(const std::string& playlist_id, int total,
+                                    std::function<void(Page<Track>)> on_page, std::function<void(bool)> done);
+    void cancel_bulk_load();
+    
+    // Pages downloaded at once by bulk loads (the library sync and load_playlist_tracks_async)
+    void set_parallel_pages(int count);
+    
+    // UI loop: deliver finished async results; the fd turns readable when some are waiting
+    void run_async_completions();
+    int async_wake_fd() const;
+    
+    // Library response cache counters (hits, misses, revalidations, coalesced requests)
+    ResponseCache::Stats get_response_cache_stats() const;
+    
+    // Local library: a LibraryIndex snapshot of the music section under directory,
+    // kept current by LibrarySync. While it holds the requested items, the async
+    // artist/album/track browsing calls answer from it instead of asking the server.
+    void start_library_sync(const std::string& directory);
+    std::shared_ptr<const LibraryIndex> get_library_index() const;
+    uint64_t get_library_index_version() const;  // Changes whenever a new snapshot is swapped in
+    LibrarySync::Status get_library_sync_status() const;
+    bool has_local_search(int library_id) const;  // search_tracks_async answers from the local library
+    
     // Playback control
     bool play_track(const Track& track);
     bool pause();
@@ -112,8 +176,18 @@ public:
 private:
     std::string server_url;
     std::string token;
+    std::string machine_id;  // Server's machineIdentifier (names the library snapshot)
     bool connected = false;
     float current_volume = 1.0f;
+    int parallel_pages = 4;
+    
+    // Music sections (type="artist") found by reload_library_sections()
+    std::vector<LibrarySection> music_sections;
+    bool sections_loaded = false;
+    // After a failed discovery, get_music_sections() answers empty until this
+    // time instead of blocking every UI call on the request timeout
+    std::chrono::steady_clock::time_point sections_retry_at;
+    static constexpr std::chrono::seconds SECTIONS_RETRY_AFTER{30};
     
     // Audio decoder for client-side waveform generation
     std::unique_ptr<AudioDecoder> audio_decoder;
@@ -122,10 +196,64 @@ private:
     std::unique_ptr<AlbumArt> album_art;
     
     // HTTP request helper
-    std::string make_request(const std::string& endpoint, const std::string& method = "GET");
+    // Library responses are requested as JSON (parsed with PlexJSON); the parsers
+    // also accept XML, which the connection check and section discovery still use
+    std::string make_request(const std::string& endpoint, const std::string& method = "GET", bool want_json = true);
+    
+    // Full URL (with token) and headers for an endpoint
+    std::string request_url(const std::string& endpoint) const;
+    std::vector<std::string> request_headers(bool want_json = true) const;
+    
+    // Response cache key: the endpoint and the representation asked for (JSON or
+    // XML), so an entry is only ever replaced by a body in the same format
+    static std::string cache_key(const std::string& endpoint, bool want_json);
+    
+    // Background conditional GET for a cached endpoint that is due a check, with
+    // the Accept header that produced the entry; a changed body replaces the entry
+    // (re-parsed with parse, if given)
+    using CacheParser = std::function<std::shared_ptr<const void>(const std::string&)>;
+    void revalidate(const std::string& endpoint, bool want_json, const ResponseCache::Entry& cached,
+                    CacheParser parse, const std::type_info* type);
+    
+    // Queue endpoint on the async executor; parse runs on the I/O thread, done on the UI thread.
+    // Cached endpoints answer from the response cache at once (see ResponseCache), and
+    // a request identical to one in flight waits for that one's answer.
+    template <typename T>
+    uint64_t request_async(const std::string& endpoint, T (PlexClient::*parse)(const std::string&),
+                           std::function<void(T)> done);
     
-    // Helper to parse tracks from XML
+    // Endpoints and response parsers shared by the sync and async calls
+    static std::string artists_endpoint(int library_id, int start, int count);
+    static std::string albums_endpoint(int library_id, const std::string& artist_id, int start, int count);
+    static std::string playlists_endpoint(int start, int count);
+    static std::string playlist_tracks_endpoint(const std::string& playlist_id, int start, int size);
+    static std::string search_endpoint(int library_id, const std::string& query, int start, int count);
+    std::vector<Artist> parse_artists(const std::string& body);
+    std::vector<Album> parse_albums(const std::string& body);
+    std::vector<Playlist> parse_playlists(const std::string& body);
+    std::vector<Track> parse_tracks(const std::string& body);  // JSON or XML
+    
+    // A list parser's items plus the container's totalSize
+    template <typename T, std::vector<T> (PlexClient::*parse)(const std::string&)>
+    Page<T> parse_page(const std::string& body);
+    static int container_total(const std::string& body);  // -1 if absent
+    
+    // Helpers to parse tracks from XML / JSON
     std::vector<Track> parse_tracks_from_xml(const std::string& xml);
+    std::vector<Track> parse_tracks_from_json(const std::string& json);
+    std::string media_url_for_part(const std::string& part_key) const;  // Streamable URL with token
+    std::string absolute_art_url(const std::string& url) const;
+    
+    // Local library answers: the snapshot for library_id (-1: any), and its items as client types
+    std::shared_ptr<const LibraryIndex> local_index(int library_id) const;
+    std::shared_ptr<const SearchIndex> local_search(int library_id) const;
+    Artist artist_from_item(const LibraryIndex::Item& item) const;
+    Album album_from_item(const LibraryIndex::Item& item) const;
+    Track track_from_item(const LibraryIndex::Item& item) const;
+    
+    // Deliver a ready result the way request_async does (next UI loop pass)
+    template <typename T>
+    uint64_t post_result(T value, std::function<void(T)> done);
     
     // Audio capture for waveform (now uses AudioDecoder)
     void start_audio_capture();
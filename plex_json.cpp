@@ -0,0 +1,333 @@
+#include "plex_json.h"
+#include <charconv>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace PlexTUI {
+
+namespace {
+
+// Offset of the first byte in [p, end) equal to one of Chars (end - p if none).
+// Compares 16 bytes at a time where SSE2 or NEON is available; this is what
+// lets the reader skip long strings and whole sub-objects quickly.
+template <char... Chars>
+size_t find_first_of(const char* p, const char* end) {
+    const char* start = p;
+#if defined(__SSE2__)
+    while (end - p >= 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i hits = _mm_setzero_si128();
+        ((hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, _mm_set1_epi8(Chars)))), ...);
+        int mask = _mm_movemask_epi8(hits);
+        if (mask != 0) {
+            return static_cast<size_t>(p - start) + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+        }
+        p += 16;
+    }
+#elif defined(__ARM_NEON)
+    while (end - p >= 16) {
+        uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+        uint8x16_t hits = vdupq_n_u8(0);
+        ((hits = vorrq_u8(hits, vceqq_u8(block, vdupq_n_u8(static_cast<uint8_t>(Chars))))), ...);
+        // Narrow to 4 bits per byte so the first hit is a trailing-zero count
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(hits), 4)), 0);
+        if (mask != 0) {
+            return static_cast<size_t>(p - start) + static_cast<size_t>(__builtin_ctzll(mask) >> 2);
+        }
+        p += 16;
+    }
+#endif
+    for (; p < end; ++p) {
+        if (((*p == Chars) || ...)) break;
+    }
+    return static_cast<size_t>(p - start);
+}
+
+bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+void append_utf8(std::string& out, uint32_t cp) {
+    if (cp <= 0x7F) {
+        out += static_cast<char>(cp);
+    } else if (cp <= 0x7FF) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp <= 0xFFFF) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp <= 0x10FFFF) {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+bool read_hex4(std::string_view text, size_t pos, uint32_t& value) {
+    if (pos + 4 > text.size()) return false;
+    value = 0;
+    for (size_t i = pos; i < pos + 4; ++i) {
+        char c = text[i];
+        value <<= 4;
+        if (c >= '0' && c <= '9') value |= static_cast<uint32_t>(c - '0');
+        else if (c >= 'a' && c <= 'f') value |= static_cast<uint32_t>(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') value |= static_cast<uint32_t>(c - 'A' + 10);
+        else return false;
+    }
+    return true;
+}
+
+long long parse_integer(std::string_view digits, long long fallback) {
+    long long value = 0;
+    auto result = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+    // "1.5" reads as 1; anything not starting with a number is the fallback
+    return result.ec == std::errc() ? value : fallback;
+}
+
+}  // namespace
+
+size_t PlexJSON::skip_space(std::string_view text, size_t pos) {
+    while (pos < text.size() && is_space(text[pos])) pos++;
+    return pos;
+}
+
+size_t PlexJSON::skip_string(std::string_view text, size_t pos) {
+    const char* end = text.data() + text.size();
+    size_t i = pos + 1;
+    while (i < text.size()) {
+        i += find_first_of<'"', '\\'>(text.data() + i, end);
+        if (i >= text.size()) break;
+        if (text[i] == '"') return i + 1;
+        i += 2;  // Escape: the next character can't end the string
+    }
+    return std::string_view::npos;
+}
+
+size_t PlexJSON::skip_container(std::string_view text, size_t pos) {
+    // Only brackets outside strings matter; the contents are checked when read
+    const char* end = text.data() + text.size();
+    int depth = 0;
+    size_t i = pos;
+    while (i < text.size()) {
+        i += find_first_of<'"', '{', '}', '[', ']'>(text.data() + i, end);
+        if (i >= text.size()) break;
+        char c = text[i];
+        if (c == '"') {
+            i = skip_string(text, i);
+            if (i == std::string_view::npos) break;
+            continue;
+        }
+        if (c == '{' || c == '[') {
+            depth++;
+        } else if (--depth == 0) {
+            return i + 1;
+        }
+        i++;
+    }
+    return std::string_view::npos;
+}
+
+size_t PlexJSON::skip_value(std::string_view text, size_t pos) {
+    if (pos >= text.size()) return std::string_view::npos;
+    char c = text[pos];
+    if (c == '"') return skip_string(text, pos);
+    if (c == '{' || c == '[') return skip_container(text, pos);
+
+    // Number or literal: runs to the next delimiter
+    size_t end = pos;
+    while (end < text.size()) {
+        char d = text[end];
+        if (d == ',' || d == '}' || d == ']' || d == ':' || is_space(d)) break;
+        end++;
+    }
+    return end > pos ? end : std::string_view::npos;
+}
+
+PlexJSON::Value PlexJSON::parse(std::string_view text) {
+    size_t start = skip_space(text, 0);
+    if (start >= text.size()) return Value();
+    if (text[start] == '{' || text[start] == '[') {
+        return Value(text.substr(start), 0);  // Walked lazily
+    }
+    size_t end = skip_value(text, start);
+    if (end == std::string_view::npos) return Value();
+    return Value(text.substr(start, end - start), end - start);
+}
+
+bool PlexJSON::looks_like_json(std::string_view text) {
+    size_t start = skip_space(text, 0);
+    return start < text.size() && (text[start] == '{' || text[start] == '[');
+}
+
+PlexJSON::Type PlexJSON::Value::type() const {
+    if (text.empty()) return Type::Missing;
+    switch (text[0]) {
+        case '{': return Type::Object;
+        case '[': return Type::Array;
+        case '"': return Type::String;
+        case 't':
+        case 'f': return Type::Bool;
+        case 'n': return Type::Null;
+        default: return Type::Number;
+    }
+}
+
+std::string_view PlexJSON::Value::raw() const {
+    if (known_end == 0 && !text.empty()) {
+        size_t end = skip_value(text, 0);
+        if (end == std::string_view::npos) return {};
+        known_end = end;
+    }
+    return text.substr(0, known_end);
+}
+
+bool PlexJSON::Value::next(size_t& pos, std::string_view* key, Value& value) const {
+    const char open = key ? '{' : '[';
+    const char close = key ? '}' : ']';
+    if (text.empty() || text[0] != open) return false;
+
+    size_t i = 1;
+    if (pos != 0) {
+        // Step over the previous value; free if its contents were walked to the end
+        size_t end = value.known_end ? pos + value.known_end : skip_value(text, pos);
+        if (end == std::string_view::npos) return false;
+        i = skip_space(text, end);
+        if (i >= text.size() || text[i] != ',') {
+            if (i < text.size() && text[i] == close) known_end = i + 1;
+            return false;
+        }
+        i++;
+    }
+    i = skip_space(text, i);
+    if (i >= text.size()) return false;
+    if (text[i] == close) {
+        known_end = i + 1;
+        return false;
+    }
+
+    if (key) {
+        if (text[i] != '"') return false;
+        size_t key_end = skip_string(text, i);
+        if (key_end == std::string_view::npos) return false;
+        *key = text.substr(i + 1, key_end - i - 2);
+        i = skip_space(text, key_end);
+        if (i >= text.size() || text[i] != ':') return false;
+        i = skip_space(text, i + 1);
+        if (i >= text.size()) return false;
+    }
+
+    if (text[i] == '{' || text[i] == '[') {
+        value = Value(text.substr(i), 0);
+    } else {
+        size_t value_end = skip_value(text, i);
+        if (value_end == std::string_view::npos) return false;
+        value = Value(text.substr(i, value_end - i), value_end - i);
+    }
+    pos = i;
+    return true;
+}
+
+PlexJSON::Value PlexJSON::Value::operator[](std::string_view wanted) const {
+    Value found;
+    for_each_member([&](std::string_view key, const Value& value) {
+        if (key != wanted) return true;
+        found = value;
+        return false;
+    });
+    return found;
+}
+
+PlexJSON::Value PlexJSON::Value::operator[](size_t index) const {
+    Value found;
+    size_t i = 0;
+    for_each_element([&](const Value& value) {
+        if (i++ != index) return true;
+        found = value;
+        return false;
+    });
+    return found;
+}
+
+std::string PlexJSON::unescape(std::string_view body) {
+    std::string out;
+    out.reserve(body.size());
+    for (size_t i = 0; i < body.size(); ++i) {
+        char c = body[i];
+        if (c != '\\' || i + 1 >= body.size()) {
+            out += c;
+            continue;
+        }
+        char e = body[++i];
+        switch (e) {
+            case 'n': out += '\n'; break;
+            case 't': out += '\t'; break;
+            case 'r': out += '\r'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'u': {
+                uint32_t cp = 0;
+                if (!read_hex4(body, i + 1, cp)) {
+                    out += e;
+                    break;
+                }
+                i += 4;
+                // Surrogate pair: a second \uXXXX carries the low half
+                uint32_t low = 0;
+                if (cp >= 0xD800 && cp <= 0xDBFF && i + 6 < body.size() &&
+                    body[i + 1] == '\\' && body[i + 2] == 'u' && read_hex4(body, i + 3, low) &&
+                    low >= 0xDC00 && low <= 0xDFFF) {
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    i += 6;
+                }
+                append_utf8(out, cp);
+                break;
+            }
+            default: out += e; break;  // \" \\ \/
+        }
+    }
+    return out;
+}
+
+std::string PlexJSON::Value::str(const std::string& fallback) const {
+    switch (type()) {
+        case Type::String: {
+            std::string_view body = text.substr(1, text.size() - 2);
+            if (body.find('\\') == std::string_view::npos) {
+                return std::string(body);
+            }
+            return unescape(body);
+        }
+        case Type::Number:
+        case Type::Bool:
+            return std::string(text);
+        default:
+            return fallback;
+    }
+}
+
+long long PlexJSON::Value::integer(long long fallback) const {
+    switch (type()) {
+        case Type::Number: return parse_integer(text, fallback);
+        case Type::String: return parse_integer(text.substr(1, text.size() - 2), fallback);
+        case Type::Bool: return text[0] == 't' ? 1 : 0;
+        default: return fallback;
+    }
+}
+
+bool PlexJSON::Value::boolean(bool fallback) const {
+    switch (type()) {
+        case Type::Bool: return text[0] == 't';
+        case Type::Number: return integer(0) != 0;
+        case Type::String: return text == "\"1\"" || text == "\"true\"";
+        default: return fallback;
+    }
+}
+
+} // namespace PlexTUI
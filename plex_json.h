@@ -0,0 +1,88 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+namespace PlexTUI {
+
+// Zero-copy JSON reader for Plex (and other web API) responses.
+// Values are views into the response text, which must outlive them. Nothing is
+// built up front: reading a member scans the enclosing object just far enough
+// to find it, skipping strings and nested containers with SIMD block scans, and
+// strings are unescaped only when read. A container's end is only looked for
+// when something has to step over it, and is remembered once its contents have
+// been walked, so a full pass reads each byte about once. Malformed input shows
+// up as missing values rather than exceptions.
+class PlexJSON {
+public:
+    enum class Type { Missing, Null, Bool, Number, String, Array, Object };
+
+    class Value {
+    public:
+        Value() = default;
+
+        Type type() const;
+        bool exists() const { return !text.empty(); }
+        bool is_array() const { return type() == Type::Array; }
+        bool is_object() const { return type() == Type::Object; }
+
+        // Object member / array element (missing Value if absent)
+        Value operator[](std::string_view key) const;
+        Value operator[](size_t index) const;
+
+        // Visit members as fn(key, value) / elements as fn(value); stops early
+        // if fn returns false. Keys are raw (Plex keys never need unescaping).
+        template <typename Fn>
+        void for_each_member(Fn&& fn) const {
+            size_t pos = 0;
+            std::string_view key;
+            Value value;
+            while (next(pos, &key, value)) {
+                if (!fn(key, value)) break;
+            }
+        }
+        template <typename Fn>
+        void for_each_element(Fn&& fn) const {
+            size_t pos = 0;
+            Value value;
+            while (next(pos, nullptr, value)) {
+                if (!fn(value)) break;
+            }
+        }
+
+        // Scalars. Strings are unescaped; numbers read as strings give their
+        // text, and numeric strings ("123") read as integers.
+        std::string str(const std::string& fallback = "") const;
+        long long integer(long long fallback = 0) const;
+        bool boolean(bool fallback = false) const;
+        std::string_view raw() const;  // Exact source text of the value
+
+    private:
+        friend class PlexJSON;
+        Value(std::string_view from, size_t end) : text(from), known_end(end) {}
+
+        // Step to the next member (key != nullptr) or element after value, which
+        // starts at pos (pos == 0: first one)
+        bool next(size_t& pos, std::string_view* key, Value& value) const;
+
+        // Source from the value's first byte; containers may run on past their end
+        std::string_view text;
+        mutable size_t known_end = 0;  // Length of the value once known (0 = not yet)
+    };
+
+    // Root value of a document (missing if text isn't a JSON value)
+    static Value parse(std::string_view text);
+
+    // Cheap format check: does the body look like JSON rather than XML?
+    static bool looks_like_json(std::string_view text);
+
+private:
+    static size_t skip_value(std::string_view text, size_t pos);   // End of the value at pos (npos if malformed)
+    static size_t skip_string(std::string_view text, size_t pos);  // pos at the opening quote
+    static size_t skip_container(std::string_view text, size_t pos);
+    static size_t skip_space(std::string_view text, size_t pos);
+    static std::string unescape(std::string_view body);
+};
+
+} // namespace PlexTUI
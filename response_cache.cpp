@@ -0,0 +1,109 @@
+#include "response_cache.h"
+
+namespace PlexTUI {
+
+ResponseCache::ResponseCache(size_t budget_bytes) : budget(budget_bytes) {
+}
+
+bool ResponseCache::cacheable(const std::string& endpoint) {
+    return endpoint.rfind("/library/", 0) == 0 || endpoint.rfind("/playlists/", 0) == 0;
+}
+
+size_t ResponseCache::cost(const std::string& key, const Entry& entry) {
+    // The parsed value is not measured; it is smaller than the XML it came from
+    size_t body = entry.body ? entry.body->size() : 0;
+    return key.size() + body * 2 + entry.etag.size() + entry.last_modified.size();
+}
+
+bool ResponseCache::lookup(const std::string& key, Entry& entry) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = slots.find(key);
+    if (it == slots.end()) {
+        counters.misses++;
+        return false;
+    }
+    counters.hits++;
+    lru.splice(lru.begin(), lru, it->second.lru_pos);
+    entry = it->second.entry;
+    return true;
+}
+
+void ResponseCache::store(const std::string& key, Entry entry) {
+    entry.validated = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (cost(key, entry) > budget) return;
+
+    auto it = slots.find(key);
+    if (it != slots.end()) {
+        counters.refreshed++;
+        total_bytes -= cost(key, it->second.entry);
+        lru.splice(lru.begin(), lru, it->second.lru_pos);
+        it->second.entry = std::move(entry);
+        total_bytes += cost(key, it->second.entry);
+    } else {
+        lru.push_front(key);
+        total_bytes += cost(key, entry);
+        slots.emplace(key, Slot{std::move(entry), lru.begin()});
+    }
+    evict();
+}
+
+void ResponseCache::set_parsed(const std::string& key, const std::shared_ptr<const std::string>& body,
+                               std::shared_ptr<const void> parsed, const std::type_info& type) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = slots.find(key);
+    if (it == slots.end() || it->second.entry.body != body) return;  // Same body object, not just equal
+    it->second.entry.parsed = std::move(parsed);
+    it->second.entry.parsed_type = &type;
+}
+
+void ResponseCache::mark_validated(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    counters.not_modified++;
+    auto it = slots.find(key);
+    if (it != slots.end()) {
+        it->second.entry.validated = std::chrono::steady_clock::now();
+    }
+}
+
+void ResponseCache::count_coalesced() {
+    std::lock_guard<std::mutex> lock(mutex);
+    counters.coalesced++;
+}
+
+bool ResponseCache::begin_revalidation(const std::string& key, const Entry& entry) {
+    if (std::chrono::steady_clock::now() - entry.validated < REVALIDATE_AFTER) return false;
+    std::lock_guard<std::mutex> lock(mutex);
+    return revalidating.insert(key).second;
+}
+
+void ResponseCache::finish_revalidation(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    revalidating.erase(key);
+}
+
+void ResponseCache::evict() {
+    while (total_bytes > budget && !lru.empty()) {
+        auto it = slots.find(lru.back());
+        total_bytes -= cost(it->first, it->second.entry);
+        slots.erase(it);
+        lru.pop_back();
+    }
+}
+
+void ResponseCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    slots.clear();
+    lru.clear();
+    total_bytes = 0;
+}
+
+ResponseCache::Stats ResponseCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    Stats result = counters;
+    result.entries = slots.size();
+    result.bytes = total_bytes;
+    return result;
+}
+
+} // namespace PlexTUI
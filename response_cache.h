@@ -0,0 +1,93 @@
+#pragma once
+
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <typeinfo>
+#include <cstdint>
+#include <cstddef>
+
+namespace PlexTUI {
+
+/**
+ * In-memory cache of Plex library responses
+ * Keyed by endpoint and format (PlexClient::cache_key) and bounded by bytes
+ * (LRU). An entry keeps the raw body, its validators (ETag / Last-Modified) and,
+ * once somebody has parsed it, the parsed result, so a repeat visit skips both
+ * the round trip and the XML parse. Entries are served even when old; callers
+ * revalidate stale ones in the background with a conditional request
+ * (stale-while-revalidate).
+ */
+class ResponseCache {
+public:
+    struct Entry {
+        std::shared_ptr<const std::string> body;     // Shared, so a hit never copies it
+        std::string etag;
+        std::string last_modified;
+        std::shared_ptr<const void> parsed;          // Parsed body, of type *parsed_type
+        const std::type_info* parsed_type = nullptr;
+        std::chrono::steady_clock::time_point validated;  // Last time the server confirmed it
+    };
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t not_modified = 0;  // Revalidations answered 304 / unchanged
+        uint64_t refreshed = 0;     // Revalidations that brought a new body
+        uint64_t coalesced = 0;     // Requests that shared an identical one already in flight
+        size_t entries = 0;
+        size_t bytes = 0;
+    };
+
+    explicit ResponseCache(size_t budget_bytes);
+
+    // Copy of the entry for key (shares the body and the parsed value); counts a hit or a miss
+    bool lookup(const std::string& key, Entry& entry);
+
+    // Insert or replace (= refreshed) an entry, validated now; then enforce the byte budget
+    void store(const std::string& key, Entry entry);
+
+    // Attach a parsed result, unless the body was replaced since it was read
+    void set_parsed(const std::string& key, const std::shared_ptr<const std::string>& body,
+                    std::shared_ptr<const void> parsed, const std::type_info& type);
+
+    // Server confirmed the cached body is current
+    void mark_validated(const std::string& key);
+
+    // True if entry is old enough to check and no check for key is running;
+    // the caller must then finish_revalidation(key) when its request completes
+    bool begin_revalidation(const std::string& key, const Entry& entry);
+    void finish_revalidation(const std::string& key);
+
+    // A request was answered by an identical one in flight (PlexClient::request_async)
+    void count_coalesced();
+
+    void clear();
+    Stats stats() const;
+
+    // Endpoints worth caching: library and playlist reads
+    static bool cacheable(const std::string& endpoint);
+
+    static constexpr std::chrono::seconds REVALIDATE_AFTER{10};
+
+private:
+    struct Slot {
+        Entry entry;
+        std::list<std::string>::iterator lru_pos;
+    };
+    static size_t cost(const std::string& key, const Entry& entry);
+    void evict();  // Caller holds the mutex
+
+    size_t budget;
+    size_t total_bytes = 0;
+    std::unordered_map<std::string, Slot> slots;
+    std::list<std::string> lru;                    // Most recently used first
+    std::unordered_set<std::string> revalidating;
+    Stats counters;
+    mutable std::mutex mutex;
+};
+
+} // namespace PlexTUI
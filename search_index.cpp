@@ -0,0 +1,452 @@
+#include "search_index.h"
+#include <algorithm>
+#include <thread>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace PlexTUI {
+
+namespace {
+
+// U+00C0..U+017F without accents (NFKD base letter, ligatures spelled out)
+const char* const LATIN_FOLD[0x180 - 0xC0] = {
+    "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",  // U+00C0
+    "d", "n", "o", "o", "o", "o", "o", " ", "o", "u", "u", "u", "u", "y", "th", "ss",  // U+00D0
+    "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",  // U+00E0
+    "d", "n", "o", "o", "o", "o", "o", " ", "o", "u", "u", "u", "u", "y", "th", "y",  // U+00F0
+    "a", "a", "a", "a", "a", "a", "c", "c", "c", "c", "c", "c", "c", "c", "d", "d",  // U+0100
+    "d", "d", "e", "e", "e", "e", "e", "e", "e", "e", "e", "e", "g", "g", "g", "g",  // U+0110
+    "g", "g", "g", "g", "h", "h", "h", "h", "i", "i", "i", "i", "i", "i", "i", "i",  // U+0120
+    "i", "i", "ij", "ij", "j", "j", "k", "k", "k", "l", "l", "l", "l", "l", "l", "l",  // U+0130
+    "l", "l", "l", "n", "n", "n", "n", "n", "n", "n", "n", "n", "o", "o", "o", "o",  // U+0140
+    "o", "o", "oe", "oe", "r", "r", "r", "r", "r", "r", "s", "s", "s", "s", "s", "s",  // U+0150
+    "s", "s", "t", "t", "t", "t", "t", "t", "u", "u", "u", "u", "u", "u", "u", "u",  // U+0160
+    "u", "u", "u", "u", "w", "w", "y", "y", "y", "z", "z", "z", "z", "z", "z", "s",  // U+0170
+};
+
+constexpr char FIELD_SEPARATOR = '\x01';
+
+// fzf's scoring: every matched character earns SCORE_MATCH plus a bonus for
+// where it sits (start of a word, right after another match), and every
+// skipped character costs a gap penalty
+constexpr int SCORE_MATCH = 16;
+constexpr int SCORE_GAP_START = -3;
+constexpr int SCORE_GAP_EXTENSION = -1;
+constexpr int BONUS_BOUNDARY = 8;
+constexpr int BONUS_CONSECUTIVE = 4;
+constexpr int BONUS_FIRST_CHAR_MULTIPLIER = 2;
+constexpr int BONUS_TITLE = 8;  // Per word matched in the title rather than artist/album
+
+// Below this many tracks per thread, starting threads costs more than it saves
+constexpr size_t TRACKS_PER_THREAD = 16384;
+
+// One bit per letter, digits sharing five bits, one for any non-ASCII byte.
+// A track can only match a word whose bits it has (in any order).
+uint32_t char_mask(std::string_view text) {
+    uint32_t mask = 0;
+    for (char ch : text) {
+        unsigned char c = static_cast<unsigned char>(ch);
+        if (c >= 'a' && c <= 'z') mask |= 1u << (c - 'a');
+        else if (c >= '0' && c <= '9') mask |= 1u << (26 + (c - '0') % 5);
+        else if (c >= 0x80) mask |= 1u << 31;
+    }
+    return mask;
+}
+
+// Append the positions in [first, last) whose mask has every bit of want.
+// Compares four masks at a time where SSE2 or NEON is available.
+void filter_masks(const uint32_t* masks, uint32_t first, uint32_t last, uint32_t want,
+                  std::vector<uint32_t>& out) {
+    uint32_t i = first;
+#if defined(__SSE2__)
+    __m128i wanted = _mm_set1_epi32(static_cast<int>(want));
+    for (; last - i >= 4; i += 4) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks + i));
+        __m128i equal = _mm_cmpeq_epi32(_mm_and_si128(block, wanted), wanted);
+        unsigned hits = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+        for (; hits != 0; hits &= hits - 1) {
+            out.push_back(i + static_cast<uint32_t>(__builtin_ctz(hits)));
+        }
+    }
+#elif defined(__ARM_NEON)
+    uint32x4_t wanted = vdupq_n_u32(want);
+    for (; last - i >= 4; i += 4) {
+        uint32x4_t equal = vceqq_u32(vandq_u32(vld1q_u32(masks + i), wanted), wanted);
+        // Narrow to 16 bits per lane so the hits fit one scalar
+        uint64_t hits = vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(equal)), 0);
+        if (hits == 0) continue;
+        for (uint32_t lane = 0; lane < 4; ++lane) {
+            if ((hits >> (lane * 16)) & 1) out.push_back(i + lane);
+        }
+    }
+#endif
+    for (; i < last; ++i) {
+        if ((masks[i] & want) == want) out.push_back(i);
+    }
+}
+
+void append_utf8(std::string& out, uint32_t cp) {
+    if (cp <= 0x7FF) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp <= 0xFFFF) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+// Bytes in the UTF-8 sequence starting with lead (1 for anything but a lead byte)
+size_t utf8_length(char lead) {
+    unsigned char c = static_cast<unsigned char>(lead);
+    return c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+}
+
+// Decode one UTF-8 sequence at text[i]; false (and length 1) if malformed
+bool decode_utf8(std::string_view text, size_t i, uint32_t& cp, size_t& length) {
+    unsigned char lead = static_cast<unsigned char>(text[i]);
+    length = utf8_length(text[i]);
+    if (length == 1 || i + length > text.size()) {
+        length = 1;
+        return false;
+    }
+    cp = lead & (0x7F >> length);
+    for (size_t k = 1; k < length; ++k) {
+        unsigned char next = static_cast<unsigned char>(text[i + k]);
+        if ((next & 0xC0) != 0x80) {
+            length = 1;
+            return false;
+        }
+        cp = (cp << 6) | (next & 0x3F);
+    }
+    return true;
+}
+
+// A query word, and the same split into characters (UTF-8 sequences)
+struct Word {
+    std::string_view text;
+    std::vector<std::string_view> chars;
+};
+
+// Whether the bytes of word occur in text in order. Needed for a fuzzy match
+// in any one field, and far cheaper, so it weeds out tracks before scoring.
+bool in_order(std::string_view text, std::string_view word) {
+    size_t k = 0;
+    for (char c : text) {
+        if (c == word[k] && ++k == word.size()) return true;
+    }
+    return false;
+}
+
+// Whether the character at text[pos] is unit
+bool char_at(std::string_view text, size_t pos, std::string_view unit) {
+    if (text[pos] != unit[0]) return false;
+    return unit.size() == 1 || (text.size() - pos >= unit.size() && text.compare(pos, unit.size(), unit) == 0);
+}
+
+// fzf's v1 match of word in field: the first occurrence of its characters in
+// order, narrowed from the back to the shortest window ending there, scored.
+// False if the characters don't all appear in order.
+bool fuzzy_match(std::string_view field, const Word& word, int& score) {
+    const auto& chars = word.chars;
+    size_t end = 0;
+    size_t k = 0;
+    for (size_t i = 0; i < field.size(); ++i) {
+        std::string_view unit = chars[k];
+        if (!char_at(field, i, unit)) continue;
+        i += unit.size() - 1;
+        if (++k == chars.size()) {
+            end = i + 1;
+            break;
+        }
+    }
+    if (k < chars.size()) return false;
+    size_t start = end;
+    for (k = chars.size(); k-- > 0;) {
+        size_t from = start - chars[k].size();
+        start = chars[k].size() == 1 ? field.rfind(chars[k][0], from) : field.rfind(chars[k], from);
+    }
+
+    score = 0;
+    bool in_gap = false;
+    int run_bonus = 0;  // Bonus of the first character of the current run of matches
+    k = 0;
+    for (size_t i = start; i < end && k < chars.size();) {
+        if (!char_at(field, i, chars[k])) {
+            score += in_gap ? SCORE_GAP_EXTENSION : SCORE_GAP_START;
+            in_gap = true;
+            run_bonus = 0;
+            i += utf8_length(field[i]);
+            continue;
+        }
+        int bonus = (i == 0 || field[i - 1] == ' ') ? BONUS_BOUNDARY : 0;
+        if (k > 0 && !in_gap) {
+            run_bonus = std::max(run_bonus, bonus);
+            bonus = std::max({bonus, run_bonus, BONUS_CONSECUTIVE});
+        } else {
+            run_bonus = bonus;
+        }
+        score += SCORE_MATCH + (k == 0 ? bonus * BONUS_FIRST_CHAR_MULTIPLIER : bonus);
+        in_gap = false;
+        i += chars[k].size();
+        k++;
+    }
+    return true;
+}
+
+// Every word must match one field (title, artist or album); the track scores
+// the sum of each word's best field
+bool score_track(std::string_view entry, const std::vector<Word>& words, int& total) {
+    for (const Word& word : words) {
+        if (!in_order(entry, word.text)) return false;
+    }
+    std::string_view fields[3];
+    for (int f = 0; f < 2; ++f) {
+        size_t end = entry.find(FIELD_SEPARATOR);
+        fields[f] = entry.substr(0, end);
+        entry.remove_prefix(end + 1);
+    }
+    fields[2] = entry;
+
+    total = 0;
+    for (const Word& word : words) {
+        bool matched = false;
+        int best = 0;
+        for (int f = 0; f < 3; ++f) {
+            int score = 0;
+            if (!fuzzy_match(fields[f], word, score)) continue;
+            if (f == 0) score += BONUS_TITLE;
+            if (!matched || score > best) best = score;
+            matched = true;
+        }
+        if (!matched) return false;
+        total += best;
+    }
+    return true;
+}
+
+struct Hit {
+    int score;
+    uint32_t length;  // Of the track's title
+    uint32_t track;
+};
+
+// Higher score first, then (as fzf does) shorter title, then browse order
+bool better(const Hit& a, const Hit& b) {
+    if (a.score != b.score) return a.score > b.score;
+    if (a.length != b.length) return a.length < b.length;
+    return a.track < b.track;
+}
+
+void keep_best(std::vector<Hit>& hits, size_t limit) {
+    if (hits.size() <= limit) return;
+    std::nth_element(hits.begin(), hits.begin() + static_cast<std::ptrdiff_t>(limit), hits.end(), better);
+    hits.resize(limit);
+}
+
+} // namespace
+
+std::string SearchIndex::fold(std::string_view text) {
+    std::string out;
+    out.reserve(text.size());
+    auto space = [&out] {
+        if (!out.empty() && out.back() != ' ') out += ' ';
+    };
+    for (size_t i = 0; i < text.size();) {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        if (c < 0x80) {
+            if (c >= 'A' && c <= 'Z') out += static_cast<char>(c - 'A' + 'a');
+            else if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) out += static_cast<char>(c);
+            else space();
+            i++;
+            continue;
+        }
+
+        uint32_t cp = 0;
+        size_t length = 1;
+        if (!decode_utf8(text, i, cp, length)) {
+            space();
+            i += length;
+            continue;
+        }
+        i += length;
+        if (cp >= 0x300 && cp <= 0x36F) {
+            continue;  // Combining accent (decomposed text)
+        } else if (cp >= 0xC0 && cp < 0x180) {
+            const char* folded = LATIN_FOLD[cp - 0xC0];
+            if (folded[0] == ' ') space();
+            else out += folded;
+        } else if (cp < 0xC0 || (cp >= 0x2000 && cp <= 0x206F) || (cp >= 0x3000 && cp <= 0x303F)) {
+            space();  // Latin-1 symbols, general and CJK punctuation
+        } else {
+            if (cp >= 0x391 && cp <= 0x3A9) cp += 0x20;        // Greek capitals
+            else if (cp >= 0x410 && cp <= 0x42F) cp += 0x20;   // Cyrillic capitals
+            else if (cp >= 0x400 && cp <= 0x40F) cp += 0x50;
+            append_utf8(out, cp);
+        }
+    }
+    if (!out.empty() && out.back() == ' ') out.pop_back();
+    return out;
+}
+
+std::shared_ptr<const SearchIndex> SearchIndex::build(std::shared_ptr<const LibraryIndex> library) {
+    if (!library) return nullptr;
+    std::shared_ptr<SearchIndex> index(new SearchIndex());
+    size_t count = library->count(LibraryIndex::Kind::Track);
+
+    index->text_start.reserve(count + 1);
+    index->masks.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        LibraryIndex::Item item = library->item(LibraryIndex::Kind::Track, i);
+        size_t start = index->text.size();
+        index->text_start.push_back(static_cast<uint32_t>(start));
+        index->text += fold(item.title);
+        index->text += FIELD_SEPARATOR;
+        index->text += fold(item.artist);
+        index->text += FIELD_SEPARATOR;
+        index->text += fold(item.album);
+        index->masks.push_back(char_mask(std::string_view(index->text).substr(start)));
+    }
+    index->text_start.push_back(static_cast<uint32_t>(index->text.size()));
+    index->snapshot = std::move(library);
+    return index;
+}
+
+std::vector<size_t> SearchIndex::search(std::string_view query, size_t limit,
+                                        const std::vector<uint32_t>* within,
+                                        std::vector<uint32_t>* matched) const {
+    if (matched) matched->clear();
+    std::string folded = fold(query);
+    std::vector<Word> words;
+    for (size_t pos = 0; pos < folded.size();) {
+        size_t end = folded.find(' ', pos);
+        if (end == std::string::npos) end = folded.size();
+        Word word;
+        word.text = std::string_view(folded).substr(pos, end - pos);
+        for (size_t i = pos; i < end;) {
+            size_t length = std::min(utf8_length(folded[i]), end - i);
+            word.chars.push_back(std::string_view(folded).substr(i, length));
+            i += length;
+        }
+        words.push_back(std::move(word));
+        pos = end + 1;
+    }
+    // Longest words first: they rule tracks out soonest
+    std::stable_sort(words.begin(), words.end(), [](const Word& a, const Word& b) {
+        return a.text.size() > b.text.size();
+    });
+    size_t count = within ? within->size() : text_start.size() - 1;
+    if (words.empty() || limit == 0 || count == 0) return {};
+    uint32_t want = char_mask(folded);
+
+    // Each slice of the tracks (or of within) is filtered and scored on its own
+    // thread, keeping its best `limit`; the slices' winners are ranked at the end
+    struct Slice {
+        std::vector<Hit> hits;
+        std::vector<uint32_t> matched;
+    };
+    std::vector<Slice> slices(std::clamp<size_t>(count / TRACKS_PER_THREAD, 1,
+                                                 std::max(1u, std::thread::hardware_concurrency())));
+    auto score_slice = [&](size_t s) {
+        uint32_t first = static_cast<uint32_t>(count * s / slices.size());
+        uint32_t last = static_cast<uint32_t>(count * (s + 1) / slices.size());
+        std::vector<uint32_t> candidates;
+        if (within) {
+            for (uint32_t i = first; i < last; ++i) {
+                uint32_t track = (*within)[i];
+                if ((masks[track] & want) == want) candidates.push_back(track);
+            }
+        } else {
+            filter_masks(masks.data(), first, last, want, candidates);
+        }
+        std::vector<Hit>& hits = slices[s].hits;
+        int floor = std::numeric_limits<int>::min();  // Lowest score still among the best `limit`
+        for (uint32_t track : candidates) {
+            int score = 0;
+            std::string_view entry(text.data() + text_start[track], text_start[track + 1] - text_start[track]);
+            if (!score_track(entry, words, score)) continue;
+            if (matched) slices[s].matched.push_back(track);
+            if (score < floor) continue;
+            hits.push_back({score, static_cast<uint32_t>(entry.find(FIELD_SEPARATOR)), track});
+            if (hits.size() >= 2 * limit) {
+                keep_best(hits, limit);
+                floor = std::min_element(hits.begin(), hits.end(), [](const Hit& a, const Hit& b) {
+                    return a.score < b.score;
+                })->score;
+            }
+        }
+        keep_best(hits, limit);
+    };
+    std::vector<std::thread> threads;
+    for (size_t s = 1; s < slices.size(); ++s) {
+        threads.emplace_back(score_slice, s);
+    }
+    score_slice(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<Hit> hits;
+    for (const Slice& slice : slices) {
+        hits.insert(hits.end(), slice.hits.begin(), slice.hits.end());
+        if (matched) matched->insert(matched->end(), slice.matched.begin(), slice.matched.end());
+    }
+    keep_best(hits, limit);
+    std::sort(hits.begin(), hits.end(), better);
+
+    std::vector<size_t> result;
+    result.reserve(hits.size());
+    for (const Hit& hit : hits) {
+        result.push_back(hit.track);
+    }
+    return result;
+}
+
+SearchCache::SearchCache(std::shared_ptr<const SearchIndex> index) : searcher(std::move(index)) {
+}
+
+std::vector<size_t> SearchCache::search(std::string_view query, size_t limit, size_t* total) {
+    if (total) *total = 0;
+    std::string folded = SearchIndex::fold(query);
+    if (folded.empty() || limit == 0) return {};
+
+    // The query itself, else the longest cached query it extends: adding
+    // characters or words only ever removes matches
+    auto base = entries.end();
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (folded.compare(0, it->query.size(), it->query) != 0) continue;
+        if (base == entries.end() || it->query.size() > base->query.size()) base = it;
+    }
+
+    if (base != entries.end() && base->query == folded) {
+        entries.splice(entries.begin(), entries, base);
+        Entry& entry = entries.front();
+        if (total) *total = entry.matched.size();
+        if (entry.ranked.size() < limit && entry.ranked.size() < entry.matched.size()) {
+            entry.ranked = searcher->search(folded, limit, &entry.matched);  // Deeper page than before
+        }
+        return std::vector<size_t>(entry.ranked.begin(),
+                                   entry.ranked.begin() + static_cast<std::ptrdiff_t>(std::min(limit, entry.ranked.size())));
+    }
+
+    Entry entry;
+    entry.query = folded;
+    entry.ranked = searcher->search(folded, limit, base != entries.end() ? &base->matched : nullptr, &entry.matched);
+    std::vector<size_t> result = entry.ranked;
+    if (total) *total = entry.matched.size();
+    entries.push_front(std::move(entry));
+    if (entries.size() > CAPACITY) entries.pop_back();
+    return result;
+}
+
+} // namespace PlexTUI
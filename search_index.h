@@ -0,0 +1,82 @@
+#pragma once
+
+#include "library_index.h"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <list>
+#include <cstdint>
+#include <cstddef>
+
+namespace PlexTUI {
+
+/**
+ * Fuzzy search over the tracks of a LibraryIndex snapshot
+ * Each track's title, artist and album are folded (lowercase, Latin accents
+ * stripped, punctuation to spaces) next to a bitmask of the characters they
+ * hold. Every query word must appear in order, gaps allowed, within one field
+ * ("bwie hroes" finds David Bowie - Heroes), scored the way fzf does: word
+ * starts and runs of consecutive characters up, gaps down. The bitmasks rule
+ * out most tracks four at a time (SSE2 / NEON) before any scoring, and large
+ * libraries are split across threads.
+ * Built once per snapshot (on the sync thread); read-only afterwards.
+ */
+class SearchIndex {
+public:
+    static std::shared_ptr<const SearchIndex> build(std::shared_ptr<const LibraryIndex> library);
+
+    // Track positions in the snapshot matching every word of query, best first
+    // (ties in browse order), at most limit. Only the tracks in within are
+    // considered when it is given; matched receives every matching track.
+    // Both are in browse order.
+    std::vector<size_t> search(std::string_view query, size_t limit,
+                               const std::vector<uint32_t>* within = nullptr,
+                               std::vector<uint32_t>* matched = nullptr) const;
+
+    const LibraryIndex& library() const { return *snapshot; }
+
+    // Search form of text: ASCII and Latin-1/Extended-A letters lowercased without
+    // accents, Greek and Cyrillic lowercased, everything not alphanumeric a space
+    static std::string fold(std::string_view text);
+
+private:
+    SearchIndex() = default;
+
+    std::shared_ptr<const LibraryIndex> snapshot;
+    std::string text;                 // Folded "title\x01artist\x01album" per track, back to back
+    std::vector<uint32_t> text_start; // Track i is text[text_start[i], text_start[i + 1])
+    std::vector<uint32_t> masks;      // Characters present in each track's text (a bit per letter)
+};
+
+/**
+ * Recent queries against one SearchIndex and every track each one matched
+ * A query that extends a cached one ("beat" -> "beatl", "beat" -> "beat l")
+ * only rescans that query's matches, and going back to one (backspace) is
+ * answered from its ranked results. Least recently used entries go first.
+ * Not thread-safe: one per caller.
+ */
+class SearchCache {
+public:
+    explicit SearchCache(std::shared_ptr<const SearchIndex> index);
+
+    // Same results as index()->search(query, limit); total, if given, receives
+    // the number of tracks matching (however many are returned)
+    std::vector<size_t> search(std::string_view query, size_t limit, size_t* total = nullptr);
+
+    const std::shared_ptr<const SearchIndex>& index() const { return searcher; }
+
+    static constexpr size_t CAPACITY = 32;
+
+private:
+    struct Entry {
+        std::string query;              // Folded
+        std::vector<uint32_t> matched;  // Every matching track, in browse order
+        std::vector<size_t> ranked;     // Best first, as many as the deepest page asked for
+    };
+
+    std::shared_ptr<const SearchIndex> searcher;
+    std::list<Entry> entries;  // Most recently used first
+};
+
+} // namespace PlexTUI
@@ -1,13 +1,207 @@
 #include "terminal.h"
 #include <unistd.h>
-#include <iostream>
-#include <sstream>
+#include <poll.h>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <cerrno>
 #include <thread>
 #include <chrono>
+#include <array>
+#include <charconv>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
 
 namespace PlexTUI {
 
-Terminal::Terminal() = default;
+namespace {
+
+// DEC private mode 2026: the terminal holds rendering between begin and end,
+// so a frame is presented atomically instead of tearing mid-redraw
+constexpr std::string_view SYNC_BEGIN = "\033[?2026h";
+constexpr std::string_view SYNC_END = "\033[?2026l";
+
+// Accept a new frame only while the backlog is below this. Over a slow link this
+// bounds input-to-screen latency to roughly budget / throughput.
+constexpr size_t PENDING_BUDGET = 32 * 1024;
+
+// Write iov to STDOUT_FILENO, resuming after EINTR and short writes.
+// With block=false it stops at EAGAIN. Returns bytes written, or -1 if the tty is gone.
+ssize_t write_iov(struct iovec* iov, int count, bool block) {
+    ssize_t total = 0;
+    while (count > 0) {
+        ssize_t n = ::writev(STDOUT_FILENO, iov, count);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                if (!block) break;
+                struct pollfd pfd = {STDOUT_FILENO, POLLOUT, 0};
+                ::poll(&pfd, 1, 100);
+                continue;
+            }
+            return -1;
+        }
+        total += n;
+        size_t written = static_cast<size_t>(n);
+        while (count > 0 && written >= iov->iov_len) {
+            written -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+        if (count > 0) {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + written;
+            iov->iov_len -= written;
+        }
+    }
+    return total;
+}
+
+// Precomputed decimal text for 0-255 so color escapes never go through to_string
+struct DecimalByte {
+    char text[3];
+    uint8_t len;
+};
+
+constexpr std::array<DecimalByte, 256> make_decimal_table() {
+    std::array<DecimalByte, 256> table{};
+    for (int i = 0; i < 256; ++i) {
+        DecimalByte d{};
+        if (i >= 100) {
+            d.text[0] = static_cast<char>('0' + i / 100);
+            d.text[1] = static_cast<char>('0' + (i / 10) % 10);
+            d.text[2] = static_cast<char>('0' + i % 10);
+            d.len = 3;
+        } else if (i >= 10) {
+            d.text[0] = static_cast<char>('0' + i / 10);
+            d.text[1] = static_cast<char>('0' + i % 10);
+            d.len = 2;
+        } else {
+            d.text[0] = static_cast<char>('0' + i);
+            d.len = 1;
+        }
+        table[i] = d;
+    }
+    return table;
+}
+
+constexpr std::array<DecimalByte, 256> DECIMAL_BYTES = make_decimal_table();
+
+inline char* put_byte(char* p, uint8_t value) {
+    const DecimalByte& d = DECIMAL_BYTES[value];
+    p[0] = d.text[0];
+    p[1] = d.text[1];
+    p[2] = d.text[2];
+    return p + d.len;
+}
+
+// Reduced color modes map every color through a 32K-entry RGB555 -> palette
+// index table, built once when the mode is selected
+ColorMode active_color_mode = ColorMode::TrueColor;
+std::array<uint8_t, 32768> color_lut{};
+
+inline size_t rgb555(uint8_t r, uint8_t g, uint8_t b) {
+    return (static_cast<size_t>(r >> 3) << 10) | (static_cast<size_t>(g >> 3) << 5) | (b >> 3);
+}
+
+// Weighted squared distance - the eye is most sensitive to green, least to blue
+inline int color_distance(int r1, int g1, int b1, int r2, int g2, int b2) {
+    int dr = r1 - r2, dg = g1 - g2, db = b1 - b2;
+    return 2 * dr * dr + 4 * dg * dg + 3 * db * db;
+}
+
+// xterm-256: 6x6x6 cube at 16-231, 24-step gray ramp at 232-255
+constexpr int CUBE_LEVELS[6] = {0, 95, 135, 175, 215, 255};
+
+uint8_t nearest_ansi256(int r, int g, int b) {
+    auto cube_index = [](int v) { return v < 48 ? 0 : v < 115 ? 1 : (v - 35) / 40; };
+    int ri = cube_index(r), gi = cube_index(g), bi = cube_index(b);
+    int cube_dist = color_distance(r, g, b, CUBE_LEVELS[ri], CUBE_LEVELS[gi], CUBE_LEVELS[bi]);
+    
+    int avg = (r + g + b) / 3;
+    int gray = avg > 238 ? 23 : std::max(0, (avg - 3) / 10);  // Level 8 + 10 * gray
+    int level = 8 + 10 * gray;
+    int gray_dist = color_distance(r, g, b, level, level, level);
+    
+    return static_cast<uint8_t>(gray_dist < cube_dist ? 232 + gray : 16 + 36 * ri + 6 * gi + bi);
+}
+
+// xterm's default 16-color palette (0-7 normal, 8-15 bright)
+constexpr uint8_t ANSI16_PALETTE[16][3] = {
+    {0, 0, 0}, {205, 0, 0}, {0, 205, 0}, {205, 205, 0},
+    {0, 0, 238}, {205, 0, 205}, {0, 205, 205}, {229, 229, 229},
+    {127, 127, 127}, {255, 0, 0}, {0, 255, 0}, {255, 255, 0},
+    {92, 92, 255}, {255, 0, 255}, {0, 255, 255}, {255, 255, 255},
+};
+
+uint8_t nearest_ansi16(int r, int g, int b) {
+    int best = 0;
+    int best_dist = color_distance(r, g, b, ANSI16_PALETTE[0][0], ANSI16_PALETTE[0][1], ANSI16_PALETTE[0][2]);
+    for (int i = 1; i < 16; ++i) {
+        int dist = color_distance(r, g, b, ANSI16_PALETTE[i][0], ANSI16_PALETTE[i][1], ANSI16_PALETTE[i][2]);
+        if (dist < best_dist) {
+            best_dist = dist;
+            best = i;
+        }
+    }
+    return static_cast<uint8_t>(best);
+}
+
+void build_color_lut(ColorMode mode) {
+    for (int i = 0; i < 32768; ++i) {
+        // Expand each 5-bit channel back to 8 bits (replicating the top bits)
+        int r = ((i >> 10) & 31) << 3 | ((i >> 12) & 7);
+        int g = ((i >> 5) & 31) << 3 | ((i >> 7) & 7);
+        int b = (i & 31) << 3 | ((i >> 2) & 7);
+        color_lut[i] = (mode == ColorMode::Ansi16) ? nearest_ansi16(r, g, b) : nearest_ansi256(r, g, b);
+    }
+}
+
+// Truecolor: ESC [ {3|4} 8 ; 2 ; r ; g ; b m  - at most 19 bytes
+// 256-color: ESC [ {3|4} 8 ; 5 ; n m           - at most 11 bytes
+// 16-color:  ESC [ {30-37|90-97|40-47|100-107} m - at most 6 bytes
+void append_sgr_rgb(std::string& out, char layer, uint8_t r, uint8_t g, uint8_t b) {
+    char buf[24];
+    char* p = buf;
+    *p++ = '\033';
+    *p++ = '[';
+    if (active_color_mode == ColorMode::TrueColor) {
+        *p++ = layer;
+        *p++ = '8';
+        *p++ = ';';
+        *p++ = '2';
+        *p++ = ';';
+        p = put_byte(p, r);
+        *p++ = ';';
+        p = put_byte(p, g);
+        *p++ = ';';
+        p = put_byte(p, b);
+    } else {
+        uint8_t index = color_lut[rgb555(r, g, b)];
+        if (active_color_mode == ColorMode::Ansi256) {
+            *p++ = layer;
+            *p++ = '8';
+            *p++ = ';';
+            *p++ = '5';
+            *p++ = ';';
+            p = put_byte(p, index);
+        } else {
+            uint8_t code = static_cast<uint8_t>((layer == '3' ? 30 : 40) + (index & 7) + (index >= 8 ? 60 : 0));
+            p = put_byte(p, code);
+        }
+    }
+    *p++ = 'm';
+    out.append(buf, static_cast<size_t>(p - buf));
+}
+
+} // namespace
+
+// Frame buffer is reused across frames; reserve enough for a full-screen repaint
+// so steady-state frames never grow it
+static constexpr size_t OUTPUT_BUFFER_RESERVE = 256 * 1024;
+
+Terminal::Terminal() {
+    output_buffer.reserve(OUTPUT_BUFFER_RESERVE);
+}
 
 Terminal::~Terminal() {
     if (initialized) {
@@ -24,14 +218,21 @@ bool Terminal::init() {
     // Get terminal size
     update_size();
     
+    // Non-blocking output: a slow tty must never stall the main loop
+    original_stdout_flags = fcntl(STDOUT_FILENO, F_GETFL);
+    if (original_stdout_flags != -1) {
+        fcntl(STDOUT_FILENO, F_SETFL, original_stdout_flags | O_NONBLOCK);
+    }
+    
     // Setup terminal
-    std::cout << "\033[?1049h";  // Alternative screen buffer
-    std::cout << "\033[?25l";     // Hide cursor
-    std::cout << "\033[2J";       // Clear screen
-    std::cout.flush();
+    output_buffer += "\033[?1049h";  // Alternative screen buffer
+    output_buffer += "\033[?25l";     // Hide cursor
+    output_buffer += "\033[2J";       // Clear screen
     
     enable_mouse();
     
+    detect_terminal_modes();
+    
     initialized = true;
     return true;
 }
@@ -39,11 +240,19 @@ bool Terminal::init() {
 void Terminal::restore() {
     if (!initialized) return;
     
+    // Drop any half-built frame - only the teardown sequences should reach the tty
+    output_buffer.clear();
+    if (sync_updates) {
+        output_buffer.append(SYNC_END);  // Never leave the terminal holding a frame
+    }
     disable_mouse();
     show_cursor();
-    std::cout << "\033[?1049l";  // Normal screen buffer
-    std::cout.flush();
+    output_buffer += "\033[?1049l";  // Normal screen buffer
+    write_blocking();
     
+    if (original_stdout_flags != -1) {
+        fcntl(STDOUT_FILENO, F_SETFL, original_stdout_flags);
+    }
     disable_raw_mode();
     initialized = false;
 }
@@ -76,7 +285,83 @@ void Terminal::move_cursor(int x, int y) {
     if (x < 0 || y < 0 || x >= 1000 || y >= 1000) {
         return;  // Skip invalid coordinates
     }
-    output_buffer += "\033[" + std::to_string(y + 1) + ";" + std::to_string(x + 1) + "H";
+    append_move(output_buffer, x, y);
+}
+
+void Terminal::append_move(std::string& out, int x, int y) {
+    // ESC [ row ; col H  - coordinates are bounded, to_chars never allocates
+    char buf[32];
+    char* p = buf;
+    *p++ = '\033';
+    *p++ = '[';
+    p = std::to_chars(p, p + 11, y + 1).ptr;  // An int never needs more than 11 chars
+    *p++ = ';';
+    p = std::to_chars(p, p + 11, x + 1).ptr;
+    *p++ = 'H';
+    out.append(buf, static_cast<size_t>(p - buf));
+}
+
+void Terminal::append_fg(std::string& out, uint8_t r, uint8_t g, uint8_t b) {
+    append_sgr_rgb(out, '3', r, g, b);
+}
+
+void Terminal::append_bg(std::string& out, uint8_t r, uint8_t g, uint8_t b) {
+    append_sgr_rgb(out, '4', r, g, b);
+}
+
+void Terminal::write_repeat(std::string_view text, int count) {
+    for (int i = 0; i < count; ++i) {
+        output_buffer.append(text);
+    }
+}
+
+void Terminal::write_clipped(std::string_view text, int max_len) {
+    if (max_len <= 0) return;
+    if (text.length() > static_cast<size_t>(max_len)) {
+        output_buffer.append(text.substr(0, static_cast<size_t>(std::max(0, max_len - 3))));
+        output_buffer.append("...");
+    } else {
+        output_buffer.append(text);
+    }
+}
+
+void Terminal::write_int(long value) {
+    char buf[24];
+    auto res = std::to_chars(buf, buf + sizeof(buf), value);
+    output_buffer.append(buf, static_cast<size_t>(res.ptr - buf));
+}
+
+void Terminal::print(int x, int y, const Theme::RGB& fg, std::string_view text, const Theme::RGB& bg) {
+    if (x < 0 || y < 0 || x >= 1000 || y >= 1000) {
+        return;  // Skip invalid coordinates
+    }
+    append_move(output_buffer, x, y);
+    append_bg(output_buffer, bg.r, bg.g, bg.b);
+    append_fg(output_buffer, fg.r, fg.g, fg.b);
+    output_buffer.append(text);
+    write_reset();
+}
+
+void Terminal::print_clipped(int x, int y, const Theme::RGB& fg, std::string_view text, int max_len,
+                             const Theme::RGB& bg) {
+    if (x < 0 || y < 0 || x >= 1000 || y >= 1000) {
+        return;  // Skip invalid coordinates
+    }
+    append_move(output_buffer, x, y);
+    append_bg(output_buffer, bg.r, bg.g, bg.b);
+    append_fg(output_buffer, fg.r, fg.g, fg.b);
+    write_clipped(text, max_len);
+    write_reset();
+}
+
+void Terminal::fill(int x, int y, int count, const Theme::RGB& bg) {
+    if (x < 0 || y < 0 || x >= 1000 || y >= 1000 || count <= 0 || count > 1000) {
+        return;  // Skip invalid coordinates
+    }
+    append_move(output_buffer, x, y);
+    append_bg(output_buffer, bg.r, bg.g, bg.b);
+    output_buffer.append(static_cast<size_t>(count), ' ');
+    write_reset();
 }
 
 void Terminal::hide_cursor() {
@@ -88,13 +373,251 @@ void Terminal::show_cursor() {
 }
 
 void Terminal::flush() {
-    // Output buffered changes
-    if (!output_buffer.empty()) {
-        std::cout << output_buffer;
+    if (output_buffer.empty()) return;
+    
+    size_t frame_bytes = output_buffer.size();
+    avg_frame_bytes = avg_frame_bytes == 0.0 ? static_cast<double>(frame_bytes)
+                                             : avg_frame_bytes * 0.8 + frame_bytes * 0.2;
+    
+    // Terminal is behind - coalesce by skipping this frame entirely
+    if (pending_bytes() > PENDING_BUDGET) {
+        output_buffer.clear();
+        frame_dropped = true;
+        return;
+    }
+    
+    // Still draining the previous frame - queue behind it to keep byte order
+    if (pending_bytes() > 0) {
+        if (sync_updates) pending_output.append(SYNC_BEGIN);
+        pending_output.append(output_buffer);
+        if (sync_updates) pending_output.append(SYNC_END);
         output_buffer.clear();
+        drain_pending();
+        return;
+    }
+    
+    // Fast path: one writev straight from the frame buffer, no iostream layer
+    struct iovec iov[3];
+    int count = 0;
+    if (sync_updates) {
+        iov[count++] = {const_cast<char*>(SYNC_BEGIN.data()), SYNC_BEGIN.size()};
+    }
+    iov[count++] = {output_buffer.data(), output_buffer.size()};
+    if (sync_updates) {
+        iov[count++] = {const_cast<char*>(SYNC_END.data()), SYNC_END.size()};
+    }
+    size_t total = frame_bytes + (sync_updates ? SYNC_BEGIN.size() + SYNC_END.size() : 0);
+    
+    ssize_t written = write_iov(iov, count, false);
+    if (written >= 0 && static_cast<size_t>(written) < total) {
+        // Short write - keep the unwritten tail for drain_pending()
+        pending_output.clear();
+        pending_offset = 0;
+        size_t skip = static_cast<size_t>(written);
+        auto keep = [&](std::string_view part) {
+            if (skip >= part.size()) {
+                skip -= part.size();
+                return;
+            }
+            pending_output.append(part.substr(skip));
+            skip = 0;
+        };
+        if (sync_updates) keep(SYNC_BEGIN);
+        keep(output_buffer);
+        if (sync_updates) keep(SYNC_END);
+        last_drain = std::chrono::steady_clock::now();
+    } else if (drain_rate > 0.0) {
+        // Whole frame taken at once - let the rate estimate recover towards "keeping up"
+        drain_rate *= 1.5;
+    }
+    output_buffer.clear();
+}
+
+void Terminal::drain_pending() {
+    if (pending_bytes() == 0) return;
+    
+    struct iovec iov = {pending_output.data() + pending_offset, pending_bytes()};
+    ssize_t written = write_iov(&iov, 1, false);
+    if (written < 0) {
+        // Terminal gone - nothing left to deliver to
+        pending_output.clear();
+        pending_offset = 0;
+        return;
+    }
+    
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - last_drain).count();
+    if (written > 0 && elapsed > 0.0) {
+        double sample = static_cast<double>(written) / elapsed;
+        drain_rate = drain_rate == 0.0 ? sample : drain_rate * 0.7 + sample * 0.3;
+    }
+    last_drain = now;
+    
+    // Drop what the tty took: frames queued behind a backlog that never quite
+    // empties would otherwise grow the string without bound
+    pending_offset += static_cast<size_t>(written);
+    pending_output.erase(0, pending_offset);
+    pending_offset = 0;
+}
+
+void Terminal::write_blocking() {
+    if (pending_bytes() > 0) {
+        pending_output.append(output_buffer);
+        struct iovec iov = {pending_output.data() + pending_offset, pending_bytes()};
+        write_iov(&iov, 1, true);
+        pending_output.clear();
+        pending_offset = 0;
+    } else if (!output_buffer.empty()) {
+        struct iovec iov = {output_buffer.data(), output_buffer.size()};
+        write_iov(&iov, 1, true);
+    }
+    output_buffer.clear();
+}
+
+bool Terminal::ready_for_frame() {
+    drain_pending();
+    return pending_bytes() <= PENDING_BUDGET;
+}
+
+bool Terminal::take_dropped_frame() {
+    bool dropped = frame_dropped;
+    frame_dropped = false;
+    return dropped;
+}
+
+std::chrono::milliseconds Terminal::frame_interval(std::chrono::milliseconds base) const {
+    if (drain_rate <= 0.0 || avg_frame_bytes <= 0.0) return base;
+    
+    // Time the tty needs to take one average frame, capped so the UI never freezes
+    auto needed = std::chrono::milliseconds(static_cast<long>(avg_frame_bytes * 1000.0 / drain_rate));
+    return std::clamp(needed, base, std::max(base, std::chrono::milliseconds(1000)));
+}
+
+void Terminal::wait_for_io(int timeout_ms, int wake_fd) {
+    struct pollfd fds[3] = {
+        {STDIN_FILENO, POLLIN, 0},
+        {STDOUT_FILENO, static_cast<short>(pending_bytes() > 0 ? POLLOUT : 0), 0},
+        {wake_fd, POLLIN, 0},  // Negative fd is ignored by poll()
+    };
+    int ready = ::poll(fds, 3, timeout_ms);
+    if (ready > 0 && (fds[1].revents & POLLOUT)) {
+        drain_pending();
+    }
+}
+
+void Terminal::detect_terminal_modes() {
+    // Ask for the state of modes 2026 and 69 (DECRQM), kitty graphics support (a
+    // query action that displays nothing) and the cell size in pixels, followed by
+    // primary device attributes. Every terminal answers DA1, so its reply bounds
+    // the wait even when the other queries are silently ignored.
+    output_buffer += "\033[?2026$p";
+    output_buffer += "\033[?69$p";
+    output_buffer += "\033_Gi=31,s=1,v=1,a=q,t=d,f=24;AAAA\033\\";
+    output_buffer += "\033[16t";
+    output_buffer += "\033[c";
+    write_blocking();
+    
+    std::string reply;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+    bool got_attributes = false;
+    while (!got_attributes) {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count();
+        if (remaining <= 0) break;
+        
+        struct pollfd pfd = {STDIN_FILENO, POLLIN, 0};
+        int ready = ::poll(&pfd, 1, static_cast<int>(remaining));
+        if (ready < 0 && errno == EINTR) continue;
+        if (ready <= 0) break;
+        
+        char buf[128];
+        ssize_t n = ::read(STDIN_FILENO, buf, sizeof(buf));
+        if (n <= 0) break;
+        reply.append(buf, static_cast<size_t>(n));
+        
+        // DA1 reply: ESC [ ? ... c
+        for (size_t da = reply.find("\033[?"); da != std::string::npos && !got_attributes;
+             da = reply.find("\033[?", da + 3)) {
+            size_t end = reply.find_first_of("c$", da + 3);
+            got_attributes = end != std::string::npos && reply[end] == 'c';
+        }
     }
     
-    std::cout.flush();
+    // DECRPM reply: ESC [ ? mode ; Ps $ y  (1 = set, 2 = reset; 0/4 = unsupported)
+    auto mode_supported = [&reply](std::string_view prefix) {
+        size_t pos = reply.find(prefix);
+        if (pos == std::string::npos || pos + prefix.size() >= reply.size()) return false;
+        char state = reply[pos + prefix.size()];
+        return state == '1' || state == '2';
+    };
+    sync_updates = mode_supported("\033[?2026;");
+    lr_margins = mode_supported("\033[?69;");
+    
+    // Cell size report: ESC [ 6 ; height ; width t (preferred over TIOCGWINSZ pixels,
+    // which some terminals leave at zero)
+    size_t cell = reply.find("\033[6;");
+    if (cell != std::string::npos) {
+        int cell_h = 0;
+        int cell_w = 0;
+        if (sscanf(reply.c_str() + cell, "\033[6;%d;%dt", &cell_h, &cell_w) == 2 && cell_w > 0 && cell_h > 0) {
+            cell_px_w = cell_w;
+            cell_px_h = cell_h;
+        }
+    }
+    
+    // Kitty answers the query with OK; sixel is attribute 4 in the DA1 reply
+    if (reply.find("\033_Gi=31;OK") != std::string::npos) {
+        graphics_protocol = GraphicsProtocol::Kitty;
+    } else {
+        size_t da = reply.rfind("\033[?");
+        size_t end = da == std::string::npos ? da : reply.find('c', da);
+        // Walk the ;-separated attribute list in place
+        for (size_t pos = da + 3; end != std::string::npos && pos <= end; ) {
+            size_t next = std::min(reply.find(';', pos), end);
+            if (reply.compare(pos, next - pos, "4") == 0) {
+                graphics_protocol = GraphicsProtocol::Sixel;
+                break;
+            }
+            pos = next + 1;
+        }
+    }
+}
+
+bool Terminal::scroll_rect(int x, int y, int w, int h, int lines) {
+    if (lines == 0) return true;
+    if (h < 2 || w <= 0 || x < 0 || y < 0 || x + w > term_width || y + h > term_height) return false;
+    if (lines >= h || -lines >= h) return false;  // Nothing survives - plain repaint is cheaper
+    bool full_width = (x == 0 && w == term_width);
+    if (!full_width && !lr_margins) return false;
+    
+    auto append_pair = [this](char final, int a, int b) {
+        output_buffer += "\033[";
+        write_int(a);
+        output_buffer += ';';
+        write_int(b);
+        output_buffer += final;
+    };
+    
+    // Margins are 1-based and inclusive; setting them homes the cursor
+    if (!full_width) {
+        output_buffer += "\033[?69h";
+        append_pair('s', x + 1, x + w);
+    }
+    append_pair('r', y + 1, y + h);
+    
+    // Erased rows take the current background (BCE) - keep it black
+    append_bg(output_buffer, 0, 0, 0);
+    output_buffer += "\033[";
+    write_int(lines > 0 ? lines : -lines);
+    output_buffer += lines > 0 ? 'S' : 'T';
+    write_reset();
+    
+    // Back to full-screen margins
+    output_buffer += "\033[r";
+    if (!full_width) {
+        output_buffer += "\033[?69l";
+    }
+    return true;
 }
 
 bool Terminal::update_size() {
@@ -107,6 +630,10 @@ bool Terminal::update_size() {
     }
     term_width = ws.ws_col > 0 ? ws.ws_col : 80;
     term_height = ws.ws_row > 0 ? ws.ws_row : 24;
+    if (ws.ws_xpixel > 0 && ws.ws_ypixel > 0 && ws.ws_col > 0 && ws.ws_row > 0) {
+        cell_px_w = ws.ws_xpixel / ws.ws_col;
+        cell_px_h = ws.ws_ypixel / ws.ws_row;
+    }
     return true;
 }
 
@@ -114,8 +641,12 @@ bool Terminal::set_window_size(int width, int height) {
     // Use ANSI escape sequence to set window size
     // Format: \033[8;height;widtht
     // This is supported by most modern terminals (Terminal.app, iTerm2, etc.)
-    std::cout << "\033[8;" << height << ";" << width << "t";
-    std::cout.flush();
+    output_buffer += "\033[8;";
+    write_int(height);
+    output_buffer += ';';
+    write_int(width);
+    output_buffer += 't';
+    write_blocking();
     
     // Give the terminal a moment to resize
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
@@ -124,43 +655,84 @@ bool Terminal::set_window_size(int width, int height) {
     return update_size();
 }
 
+void Terminal::set_color_mode(ColorMode mode) {
+    if (mode != ColorMode::TrueColor) {
+        build_color_lut(mode);
+    }
+    active_color_mode = mode;
+}
+
+ColorMode Terminal::color_mode() {
+    return active_color_mode;
+}
+
+ColorMode Terminal::detect_color_mode() {
+    // COLORTERM is the de facto truecolor announcement (usually not forwarded
+    // over SSH, where the smaller escapes are welcome anyway)
+    const char* colorterm = getenv("COLORTERM");
+    if (colorterm) {
+        std::string_view ct = colorterm;
+        if (ct == "truecolor" || ct == "24bit") return ColorMode::TrueColor;
+    }
+    const char* term_env = getenv("TERM");
+    std::string_view term = term_env ? term_env : "";
+    if (term.find("direct") != std::string_view::npos) return ColorMode::TrueColor;
+    if (term.find("256color") != std::string_view::npos) return ColorMode::Ansi256;
+    if (term.empty() || term == "dumb") return ColorMode::Ansi16;
+    // Known truecolor terminals that don't always set COLORTERM
+    for (std::string_view name : {"xterm-kitty", "alacritty", "foot", "wezterm", "xterm-ghostty"}) {
+        if (term == name) return ColorMode::TrueColor;
+    }
+    return ColorMode::Ansi16;
+}
+
+bool Terminal::parse_color_mode(std::string_view name, ColorMode& mode) {
+    if (name == "truecolor" || name == "24bit") {
+        mode = ColorMode::TrueColor;
+    } else if (name == "256") {
+        mode = ColorMode::Ansi256;
+    } else if (name == "16") {
+        mode = ColorMode::Ansi16;
+    } else {
+        return false;
+    }
+    return true;
+}
+
 std::string Terminal::fg_color(uint8_t r, uint8_t g, uint8_t b) {
-    return "\033[38;2;" + std::to_string(r) + ";" + 
-           std::to_string(g) + ";" + std::to_string(b) + "m";
+    std::string out;
+    append_fg(out, r, g, b);
+    return out;
 }
 
 std::string Terminal::bg_color(uint8_t r, uint8_t g, uint8_t b) {
-    return "\033[48;2;" + std::to_string(r) + ";" + 
-           std::to_string(g) + ";" + std::to_string(b) + "m";
+    std::string out;
+    append_bg(out, r, g, b);
+    return out;
 }
 
 std::string Terminal::reset_color() {
     return "\033[0m";
 }
 
-void Terminal::draw_box(int x, int y, int w, int h, const std::string& title) {
+void Terminal::draw_box(int x, int y, int w, int h, std::string_view title) {
     if (w < 2 || h < 2) return;
     
     // Fill interior with black background (btop style)
-    std::string black_bg = bg_color(0, 0, 0);
     for (int row = 1; row < h - 1; ++row) {
-        move_cursor(x + 1, y + row);
-        std::string fill(w - 2, ' ');
-        output_buffer += black_bg + fill + reset_color();
+        fill(x + 1, y + row, w - 2);
     }
     
     // Top border
     move_cursor(x, y);
     output_buffer += "╭";
     if (!title.empty() && title.length() + 4 < static_cast<size_t>(w)) {
-        output_buffer += "─ " + title + " ";
-        for (int i = title.length() + 4; i < w - 1; ++i) {
-            output_buffer += "─";
-        }
+        output_buffer += "─ ";
+        output_buffer.append(title);
+        output_buffer += " ";
+        write_repeat("─", w - 1 - static_cast<int>(title.length() + 4));
     } else {
-        for (int i = 1; i < w - 1; ++i) {
-            output_buffer += "─";
-        }
+        write_repeat("─", w - 2);
     }
     output_buffer += "╮";
     
@@ -175,13 +747,11 @@ void Terminal::draw_box(int x, int y, int w, int h, const std::string& title) {
     // Bottom border
     move_cursor(x, y + h - 1);
     output_buffer += "╰";
-    for (int i = 1; i < w - 1; ++i) {
-        output_buffer += "─";
-    }
+    write_repeat("─", w - 2);
     output_buffer += "╯";
 }
 
-void Terminal::draw_text(int x, int y, const std::string& text) {
+void Terminal::draw_text(int x, int y, std::string_view text) {
     // Bounds check to prevent invalid coordinates (btop-style: reasonable limits)
     if (x < 0 || y < 0 || x >= 1000 || y >= 1000) {
         return;  // Skip invalid coordinates
@@ -189,39 +759,34 @@ void Terminal::draw_text(int x, int y, const std::string& text) {
     // Just move cursor and draw - don't clear line (causes flicker)
     // The background fill handles clearing
     move_cursor(x, y);
-    output_buffer += text;
+    output_buffer.append(text);
 }
 
-void Terminal::draw_horizontal_line(int x, int y, int length, const std::string& c) {
+void Terminal::draw_horizontal_line(int x, int y, int length, std::string_view c) {
     move_cursor(x, y);
-    for (int i = 0; i < length; ++i) {
-        output_buffer += c;
-    }
+    write_repeat(c, length);
 }
 
-void Terminal::draw_vertical_line(int x, int y, int length, const std::string& c) {
+void Terminal::draw_vertical_line(int x, int y, int length, std::string_view c) {
     for (int i = 0; i < length; ++i) {
         move_cursor(x, y + i);
-        output_buffer += c;
+        output_buffer.append(c);
     }
 }
 
 void Terminal::enable_mouse() {
-    // Flush mouse enable immediately (btop style)
-    std::cout << "\033[?1000h";  // Normal mouse tracking
-    std::cout << "\033[?1002h";  // Button event tracking
-    std::cout << "\033[?1015h";  // Extended coordinates
-    std::cout << "\033[?1006h";  // SGR extended mode
-    std::cout.flush();
+    // Queued with the rest of the output - reaches the tty on the next write
+    output_buffer += "\033[?1000h";  // Normal mouse tracking
+    output_buffer += "\033[?1002h";  // Button event tracking
+    output_buffer += "\033[?1015h";  // Extended coordinates
+    output_buffer += "\033[?1006h";  // SGR extended mode
 }
 
 void Terminal::disable_mouse() {
-    // Flush mouse disable immediately
-    std::cout << "\033[?1006l";
-    std::cout << "\033[?1015l";
-    std::cout << "\033[?1002l";
-    std::cout << "\033[?1000l";
-    std::cout.flush();
+    output_buffer += "\033[?1006l";
+    output_buffer += "\033[?1015l";
+    output_buffer += "\033[?1002l";
+    output_buffer += "\033[?1000l";
 }
 
 } // namespace PlexTUI
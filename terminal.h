@@ -1,12 +1,29 @@
 #pragma once
 
+#include "types.h"
 #include <string>
+#include <string_view>
 #include <cstdint>
+#include <chrono>
 #include <termios.h>
 #include <sys/ioctl.h>
 
 namespace PlexTUI {
 
+// Color depth of emitted SGR escapes
+enum class ColorMode {
+    TrueColor,  // 38;2;r;g;b
+    Ansi256,    // 38;5;n (xterm cube + gray ramp)
+    Ansi16,     // 30-37 / 90-97
+};
+
+// Pixel graphics protocol for album art
+enum class GraphicsProtocol {
+    None,   // Half-block text art
+    Kitty,  // Kitty graphics protocol (image uploaded once, placed by id)
+    Sixel,  // DEC sixel
+};
+
 class Terminal {
 public:
     Terminal();
@@ -21,24 +38,76 @@ public:
     void move_cursor(int x, int y);
     void hide_cursor();
     void show_cursor();
-    void flush();  // Flush buffered output (with smart diff rendering)
+    void flush();  // Write the buffered frame to the tty in a single writev
+    
+    // Backpressure (stdout is non-blocking): a frame the tty can't take yet is
+    // kept as pending bytes; frames arriving while the backlog is over budget
+    // are dropped and the caller is told to repaint in full.
+    bool ready_for_frame();                 // Drains what it can, false while over budget
+    bool take_dropped_frame();              // True once after a frame was discarded
+    size_t pending_bytes() const { return pending_output.size() - pending_offset; }
+    std::chrono::milliseconds frame_interval(std::chrono::milliseconds base) const;  // Adapted to drain rate
+    void wait_for_io(int timeout_ms, int wake_fd = -1);  // Sleep until input, output drain, wake_fd readable or timeout
     
     // Terminal properties
     int width() const { return term_width; }
     int height() const { return term_height; }
     bool update_size();
     bool set_window_size(int width, int height);  // Set terminal window size
+    bool synchronized_updates() const { return sync_updates; }  // DEC 2026 detected at init
+    GraphicsProtocol graphics() const { return graphics_protocol; }  // Detected at init (kitty preferred)
+    int cell_pixel_width() const { return cell_px_w; }    // 0 when the terminal doesn't say
+    int cell_pixel_height() const { return cell_px_h; }
+    
+    // Hardware scroll: shift the contents of a rectangle by `lines` rows (positive
+    // moves content up) using DECSTBM, plus DECSLRM margins when the rect is
+    // narrower than the screen. Exposed rows are left blank (black) for the caller
+    // to paint. Returns false when the terminal can't do it - repaint instead.
+    bool scroll_rect(int x, int y, int w, int h, int lines);
     
-    // Color output (24-bit true color)
+    // Color depth for every color escape (process-wide, since album art lines are
+    // encoded without a Terminal). Reduced modes quantize through an RGB555 LUT
+    // that is built when the mode is set; set it before the first frame.
+    static void set_color_mode(ColorMode mode);
+    static ColorMode color_mode();
+    static ColorMode detect_color_mode();  // From COLORTERM / TERM
+    static bool parse_color_mode(std::string_view name, ColorMode& mode);  // "truecolor", "256", "16"
+    
+    // Color output (24-bit true color, or quantized per color_mode())
+    // These return temporaries - prefer the write_* API below in draw code
     std::string fg_color(uint8_t r, uint8_t g, uint8_t b);
     std::string bg_color(uint8_t r, uint8_t g, uint8_t b);
     std::string reset_color();
     
+    // Append-style writers (btop-style: escapes are formatted straight into the
+    // reusable frame buffer, so a steady-state frame allocates nothing)
+    void write(std::string_view text) { output_buffer.append(text); }
+    void write_repeat(std::string_view text, int count);
+    void write_clipped(std::string_view text, int max_len);  // Truncate with "..." past max_len
+    void write_int(long value);
+    void write_fg(uint8_t r, uint8_t g, uint8_t b) { append_fg(output_buffer, r, g, b); }
+    void write_bg(uint8_t r, uint8_t g, uint8_t b) { append_bg(output_buffer, r, g, b); }
+    void write_fg(const Theme::RGB& c) { append_fg(output_buffer, c.r, c.g, c.b); }
+    void write_bg(const Theme::RGB& c) { append_bg(output_buffer, c.r, c.g, c.b); }
+    void write_reset() { output_buffer.append("\033[0m"); }
+    
+    // Positioned, colored text: move + bg + fg + text + reset (bg defaults to black)
+    void print(int x, int y, const Theme::RGB& fg, std::string_view text,
+               const Theme::RGB& bg = Theme::RGB());
+    void print_clipped(int x, int y, const Theme::RGB& fg, std::string_view text, int max_len,
+                       const Theme::RGB& bg = Theme::RGB());
+    void fill(int x, int y, int count, const Theme::RGB& bg = Theme::RGB());  // Background-colored blanks
+    
+    // Escape encoders for renderers that build their own line buffers (album art)
+    static void append_fg(std::string& out, uint8_t r, uint8_t g, uint8_t b);
+    static void append_bg(std::string& out, uint8_t r, uint8_t g, uint8_t b);
+    static void append_move(std::string& out, int x, int y);
+    
     // Drawing primitives
-    void draw_box(int x, int y, int w, int h, const std::string& title = "");
-    void draw_text(int x, int y, const std::string& text);
-    void draw_horizontal_line(int x, int y, int length, const std::string& c = "─");
-    void draw_vertical_line(int x, int y, int length, const std::string& c = "│");
+    void draw_box(int x, int y, int w, int h, std::string_view title = {});
+    void draw_text(int x, int y, std::string_view text);
+    void draw_horizontal_line(int x, int y, int length, std::string_view c = "─");
+    void draw_vertical_line(int x, int y, int length, std::string_view c = "│");
     
     // Mouse support
     void enable_mouse();
@@ -49,10 +118,27 @@ private:
     int term_height = 0;
     struct termios original_termios;
     bool initialized = false;
+    bool sync_updates = false;  // Wrap frames in DEC 2026 begin/end markers
+    bool lr_margins = false;    // DECLRMM (mode 69) available for column-limited scrolling
+    GraphicsProtocol graphics_protocol = GraphicsProtocol::None;
+    int cell_px_w = 0;          // Character cell size in pixels (TIOCGWINSZ or CSI 16 t)
+    int cell_px_h = 0;
     std::string output_buffer;
     
+    // Output backlog state
+    int original_stdout_flags = -1;
+    std::string pending_output;  // Bytes accepted for output but not yet taken by the tty
+    size_t pending_offset = 0;
+    bool frame_dropped = false;
+    double drain_rate = 0.0;       // Bytes/sec EWMA measured while backlogged (0 = keeping up)
+    double avg_frame_bytes = 0.0;  // EWMA of frame size
+    std::chrono::steady_clock::time_point last_drain;
+    
     void enable_raw_mode();
     void disable_raw_mode();
+    void write_blocking();  // Queue output_buffer behind the backlog and wait for all of it
+    void drain_pending();   // Non-blocking: push as much backlog as the tty accepts
+    void detect_terminal_modes();  // DECRQM probe for modes 2026 and 69, graphics support
 };
 
 } // namespace PlexTUI
@@ -100,10 +100,15 @@ struct Theme {
 struct Config {
     std::string plex_server_url;
     std::string plex_token;
+    int parallel_pages = 4;     // Pages of a long list downloaded at once (library sync, shuffle)
     int max_waveform_points = 100;
     int refresh_rate_ms = 250;  // 4 FPS - btop-style smooth rendering, good for waveforms
     int window_width = 145;     // Default terminal window width (columns)
     int window_height = 40;     // Default terminal window height (rows)
+    std::string color_mode = "auto";  // auto, truecolor, 256 or 16 (smaller escapes for slow links)
+    int art_palette = 0;              // Album art palette size (0 = full color, 16-64 shrinks output)
+    bool art_dither = false;          // Ordered dithering when art_palette is set
+    std::string art_protocol = "auto";  // auto, kitty, sixel or blocks (half-block text art)
     Theme theme;
     
     // Feature toggles
@@ -114,6 +119,10 @@ struct Config {
     bool enable_debug_logging = false;  // Enable debug logging to stderr and log file (default: off)
     std::string debug_log_file_path;    // Path to debug log file (default: next to config.ini)
     
+    // Cache
+    int art_cache_mb = 64;              // On-disk album art cache budget (0 = disabled)
+    bool library_sync = true;           // Keep a local copy of the music library for browsing
+    
     // PLACEHOLDER: User preferences
     // - keybindings, library filters, display options
     
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace PlexTUI {
+
+// Percent-encode text for a URL path segment or query value: everything but
+// the RFC 3986 unreserved characters becomes %XX (space included, as %20)
+inline std::string url_encode(std::string_view text) {
+    static constexpr char HEX[] = "0123456789ABCDEF";
+    std::string encoded;
+    encoded.reserve(text.size() * 3);  // Worst case: all chars need encoding
+    for (char c : text) {
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+            (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.' || c == '~') {
+            encoded += c;
+        } else {
+            unsigned char byte = static_cast<unsigned char>(c);
+            encoded += '%';
+            encoded += HEX[byte >> 4];
+            encoded += HEX[byte & 0x0F];
+        }
+    }
+    return encoded;
+}
+
+} // namespace PlexTUI
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <vector>
+#include <map>
+#include <functional>
+#include <algorithm>
+#include <cstdint>
+#include <chrono>
+
+namespace PlexTUI {
+
+/**
+ * A long list read from the server a page at a time
+ * The fetch function asks for one page (start, count) in the background and
+ * hands back its items with the length of the whole list when the server
+ * reports it (X-Plex-Container-Size / totalSize). Drawing passes the rows on
+ * screen to show(): missing pages there are requested, PREFETCH_PAGES more
+ * follow in the direction of travel, and pages further than KEEP_PAGES away
+ * are dropped (in-flight ones cancelled), so memory stays bounded however
+ * far the list is scrolled. Rows still loading read as a default T. Without
+ * a reported length the list grows page by page and ends at a short page.
+ * A page whose request failed is not the end of the list: it is asked for
+ * again RETRY_AFTER later (retry(), or the next show() that covers it).
+ * UI thread only; answers for a replaced source are ignored.
+ */
+template <typename T>
+class VirtualList {
+public:
+    // total -1: not reported; ok false: the request failed (items and total mean nothing)
+    using Done = std::function<void(std::vector<T> items, int total, bool ok)>;
+    using Fetch = std::function<uint64_t(int start, int count, Done done)>;  // Returns the request id
+    using Cancel = std::function<void(uint64_t id)>;
+
+    explicit VirtualList(Cancel cancel, int page_size = 100)
+        : cancel(std::move(cancel)), page_size(std::max(1, page_size)) {}
+    ~VirtualList() { clear(); }
+    VirtualList(const VirtualList&) = delete;  // Callbacks in flight point at this object
+    VirtualList& operator=(const VirtualList&) = delete;
+
+    // New source: forget the old rows and request the first page
+    void reset(Fetch source) {
+        clear();
+        fetch = std::move(source);
+        request(0);
+    }
+
+    // New source whose first page (and length, if known) has already arrived
+    void reset(Fetch source, std::vector<T> first_page, int total) {
+        clear();
+        fetch = std::move(source);
+        pages[0].ready = true;
+        receive(0, std::move(first_page), total);
+    }
+
+    // Whole list at once (nothing to fetch)
+    void assign(std::vector<T> items) {
+        clear();
+        attached_ = true;
+        known_total = static_cast<int>(items.size());
+        extent = known_total;
+        for (int start = 0; start < known_total; start += page_size) {
+            Page& page = pages[start / page_size];
+            page.ready = true;
+            page.items.assign(std::make_move_iterator(items.begin() + start),
+                              std::make_move_iterator(items.begin() + std::min(known_total, start + page_size)));
+        }
+    }
+
+    void clear() {
+        for (auto& [number, page] : pages) {
+            if (page.request != 0) cancel(page.request);
+        }
+        pages.clear();
+        retry_at.clear();
+        fetch = nullptr;
+        attached_ = false;
+        generation++;
+        known_total = -1;
+        extent = 0;
+        held_first = -1;
+        held_count = 0;
+        last_first = 0;
+        last_count = 0;
+        direction = 1;
+        revision++;
+    }
+
+    // Rows in the list: its reported length, else as far as pages have reached
+    int size() const { return known_total >= 0 ? known_total : extent; }
+    bool empty() const { return size() == 0; }
+    bool attached() const { return attached_ || fetch != nullptr; }  // reset() or assign() since clear()
+    bool loading() const { return empty() && pending() > 0; }  // Waiting for the first rows
+    int pending() const {
+        return static_cast<int>(std::count_if(pages.begin(), pages.end(),
+                                              [](const auto& entry) { return entry.second.request != 0; }));
+    }
+
+    // Changes when rows on screen (as of the last show()) arrive, or the source changes
+    uint64_t version() const { return revision; }
+    
+    bool loaded(int index) const { return find(index) != nullptr; }
+    const T& operator[](int index) const {
+        static const T loading_row{};
+        const T* item = find(index);
+        return item ? *item : loading_row;
+    }
+
+    // Rows [first, first + count) are on screen
+    void show(int first, int count) {
+        if (!fetch) return;
+        if (first != last_first) direction = first > last_first ? 1 : -1;
+        last_first = first;
+        last_count = count;
+        int first_page = std::max(0, first) / page_size;
+        int last_page = (std::max(0, first) + std::max(1, count) - 1) / page_size;
+        for (int page = first_page; page <= last_page; ++page) {
+            request(page);
+        }
+        for (int ahead = 1; ahead <= PREFETCH_PAGES; ++ahead) {
+            request(direction > 0 ? last_page + ahead : first_page - ahead);
+        }
+        for (auto it = pages.begin(); it != pages.end();) {
+            int page = it->first;
+            if ((page >= first_page - KEEP_PAGES && page <= last_page + KEEP_PAGES) || is_held(page)) {
+                ++it;
+                continue;
+            }
+            if (it->second.request != 0) cancel(it->second.request);
+            it = pages.erase(it);
+        }
+    }
+
+    // Keep rows [first, first + count) loaded wherever the list is scrolled
+    // (e.g. the playing track and the next one) until the source changes
+    void hold(int first, int count) {
+        held_first = first;
+        held_count = count;
+        if (!fetch || first < 0) return;
+        for (int page = first / page_size; page <= (first + std::max(1, count) - 1) / page_size; ++page) {
+            request(page);
+        }
+    }
+    int held() const { return held_first; }  // First held row, -1 if none
+
+    // Call every loop pass: requests failed pages (on screen or held) once their retry is due
+    void retry() {
+        if (!fetch || retry_at.empty()) return;
+        auto now = std::chrono::steady_clock::now();
+        if (std::none_of(retry_at.begin(), retry_at.end(), [now](const auto& entry) { return entry.second <= now; })) {
+            return;
+        }
+        if (last_count > 0) show(last_first, last_count);
+        if (held_first >= 0) hold(held_first, held_count);
+    }
+
+    static constexpr int PREFETCH_PAGES = 2;
+    static constexpr int KEEP_PAGES = 4;
+    static constexpr std::chrono::seconds RETRY_AFTER{2};
+
+private:
+    struct Page {
+        std::vector<T> items;
+        uint64_t request = 0;  // In flight
+        bool ready = false;
+    };
+
+    const T* find(int index) const {
+        if (index < 0) return nullptr;
+        auto it = pages.find(index / page_size);
+        if (it == pages.end() || static_cast<size_t>(index % page_size) >= it->second.items.size()) {
+            return nullptr;
+        }
+        return &it->second.items[static_cast<size_t>(index % page_size)];
+    }
+
+    bool is_held(int page) const {
+        return held_first >= 0 && page >= held_first / page_size &&
+               page <= (held_first + std::max(1, held_count) - 1) / page_size;
+    }
+
+    void request(int page) {
+        if (page < 0 || pages.count(page)) return;
+        auto failed = retry_at.find(page);
+        if (failed != retry_at.end()) {
+            if (std::chrono::steady_clock::now() < failed->second) return;
+            retry_at.erase(failed);
+        }
+        int start = page * page_size;
+        // Past the end, or (length unknown) beyond the page after the last one seen
+        if (known_total >= 0 ? start >= known_total : start > extent) return;
+        pages[page];
+        uint64_t id = fetch(start, page_size, [this, gen = generation, page](std::vector<T> items, int total, bool ok) {
+            if (gen != generation) return;
+            auto it = pages.find(page);
+            if (it == pages.end() || it->second.ready) return;  // Dropped while in flight
+            if (!ok) {
+                pages.erase(it);
+                retry_at[page] = std::chrono::steady_clock::now() + RETRY_AFTER;
+                return;
+            }
+            it->second.request = 0;
+            it->second.ready = true;
+            receive(page, std::move(items), total);
+        });
+        // Answers can arrive before fetch returns (no I/O thread)
+        auto it = pages.find(page);
+        if (it != pages.end() && !it->second.ready) it->second.request = id;
+    }
+
+    void receive(int page, std::vector<T> items, int total) {
+        int end = page * page_size + static_cast<int>(items.size());
+        if (total >= 0) {
+            known_total = total;
+        } else if (static_cast<int>(items.size()) < page_size) {
+            known_total = end;  // Short page: the list ends here
+        }
+        extent = std::max(extent, end);
+        pages[page].items = std::move(items);
+        int start = page * page_size;
+        if (last_count == 0 || (start < last_first + last_count && start + page_size > last_first)) {
+            revision++;  // Not shown yet, or on screen
+        }
+    }
+
+    Cancel cancel;
+    int page_size;
+    Fetch fetch;
+    bool attached_ = false;
+    uint64_t generation = 0;
+    std::map<int, Page> pages;
+    std::map<int, std::chrono::steady_clock::time_point> retry_at;  // Failed pages: not before then
+    int known_total = -1;
+    int extent = 0;         // End of the furthest page received
+    int held_first = -1;
+    int held_count = 0;
+    int last_first = 0;     // Window of the last show()
+    int last_count = 0;
+    int direction = 1;      // Scrolling down (1) or up (-1)
+    uint64_t revision = 0;
+};
+
+} // namespace PlexTUI
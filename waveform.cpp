@@ -99,10 +99,11 @@ void Waveform::draw_mirrored_style(Terminal& term, int x, int y, const Theme& th
     // This gives 256 possible patterns (2^8) for much finer vertical resolution
     
     // Lock mutex and make a copy of samples to avoid holding lock during drawing
-    std::deque<float> samples_copy;
+    // (into a reused scratch buffer - no allocation once it has grown)
+    std::vector<float>& samples_copy = draw_samples;
     {
         std::lock_guard<std::mutex> lock(samples_mutex);
-        samples_copy = samples;
+        samples_copy.assign(samples.begin(), samples.end());
     }
     
     // Calculate the actual vertical resolution (in dots, since Braille has 4 dots per character)
@@ -112,7 +113,6 @@ void Waveform::draw_mirrored_style(Terminal& term, int x, int y, const Theme& th
     int total_dots = char_rows * 4;  // Total vertical resolution in dots (4 dots per character)
     
     int mid_y = total_dots / 2;  // Center in dot space
-    std::string black_bg = term.bg_color(0, 0, 0);
     
     // Use full height - remove 75% limit to allow waveform to use all 9 lines
     float max_bar_height = static_cast<float>(mid_y);  // Full height from center (100% of available space)
@@ -163,8 +163,6 @@ void Waveform::draw_mirrored_style(Terminal& term, int x, int y, const Theme& th
             b = static_cast<uint8_t>(theme.waveform_tertiary.b + (255 - theme.waveform_tertiary.b) * t_grad);
         }
         
-        std::string color = term.fg_color(r, g, b);
-        
         // btop-style: Render using Braille characters for high resolution
         // Each character cell represents 4 vertical positions (8 dots: 2 cols x 4 rows)
         // Calculate how many character rows we need
@@ -242,7 +240,11 @@ void Waveform::draw_mirrored_style(Terminal& term, int x, int y, const Theme& th
                     braille_utf8[3] = '\0';
                 }
                 
-                term.draw_text(x + col, draw_y, black_bg + color + std::string(braille_utf8) + term.reset_color());
+                term.move_cursor(x + col, draw_y);
+                term.write_bg(0, 0, 0);
+                term.write_fg(r, g, b);
+                term.write(braille_utf8);
+                term.write_reset();
             }
         }
     }
@@ -250,46 +252,46 @@ void Waveform::draw_mirrored_style(Terminal& term, int x, int y, const Theme& th
 
 void Waveform::draw_line_style(Terminal& term, int x, int y, const Theme& theme) {
     // Lock mutex and make a copy of samples to avoid holding lock during drawing
-    std::deque<float> samples_copy;
+    // (into a reused scratch buffer - no allocation once it has grown)
+    std::vector<float>& samples_copy = draw_samples;
     {
         std::lock_guard<std::mutex> lock(samples_mutex);
-        samples_copy = samples;
+        samples_copy.assign(samples.begin(), samples.end());
     }
     
-    std::string color = term.fg_color(theme.waveform_primary.r, 
-                                     theme.waveform_primary.g, 
-                                     theme.waveform_primary.b);
-    
     for (int col = 0; col < width && col < static_cast<int>(samples_copy.size()); ++col) {
         float level = samples_copy[col];
         int draw_y = y + height - 1 - static_cast<int>(level * (height - 1));
         
         if (draw_y >= y && draw_y < y + height) {
-            term.draw_text(x + col, draw_y, color + "●" + term.reset_color());
+            term.move_cursor(x + col, draw_y);
+            term.write_fg(theme.waveform_primary);
+            term.write("●");
+            term.write_reset();
         }
     }
 }
 
 void Waveform::draw_bars_style(Terminal& term, int x, int y, const Theme& theme) {
     // Lock mutex and make a copy of samples to avoid holding lock during drawing
-    std::deque<float> samples_copy;
+    // (into a reused scratch buffer - no allocation once it has grown)
+    std::vector<float>& samples_copy = draw_samples;
     {
         std::lock_guard<std::mutex> lock(samples_mutex);
-        samples_copy = samples;
+        samples_copy.assign(samples.begin(), samples.end());
     }
     
     for (int col = 0; col < width && col < static_cast<int>(samples_copy.size()); ++col) {
         float level = samples_copy[col];
         int bar_height = static_cast<int>(level * height);
         
-        std::string color = term.fg_color(theme.waveform_primary.r, 
-                                         theme.waveform_primary.g, 
-                                         theme.waveform_primary.b);
-        
         for (int row = 0; row < bar_height; ++row) {
             int draw_y = y + height - row - 1;
             if (draw_y >= y && draw_y < y + height) {
-                term.draw_text(x + col, draw_y, color + "█" + term.reset_color());
+                term.move_cursor(x + col, draw_y);
+                term.write_fg(theme.waveform_primary);
+                term.write("█");
+                term.write_reset();
             }
         }
     }
@@ -297,10 +299,11 @@ void Waveform::draw_bars_style(Terminal& term, int x, int y, const Theme& theme)
 
 void Waveform::draw_filled_style(Terminal& term, int x, int y, const Theme& theme) {
     // Lock mutex and make a copy of samples to avoid holding lock during drawing
-    std::deque<float> samples_copy;
+    // (into a reused scratch buffer - no allocation once it has grown)
+    std::vector<float>& samples_copy = draw_samples;
     {
         std::lock_guard<std::mutex> lock(samples_mutex);
-        samples_copy = samples;
+        samples_copy.assign(samples.begin(), samples.end());
     }
     
     // Similar to bars but with gradient
@@ -314,11 +317,13 @@ void Waveform::draw_filled_style(Terminal& term, int x, int y, const Theme& them
             uint8_t g = static_cast<uint8_t>(theme.waveform_primary.g * intensity);
             uint8_t b = static_cast<uint8_t>(theme.waveform_primary.b * intensity);
             
-            std::string color = term.fg_color(r, g, b);
             int draw_y = y + height - row - 1;
             
             if (draw_y >= y && draw_y < y + height) {
-                term.draw_text(x + col, draw_y, color + "▓" + term.reset_color());
+                term.move_cursor(x + col, draw_y);
+                term.write_fg(r, g, b);
+                term.write("▓");
+                term.write_reset();
             }
         }
     }
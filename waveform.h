@@ -43,6 +43,7 @@ private:
     WaveformStyle style = WaveformStyle::Mirrored;
     std::deque<float> samples;  // Rolling buffer of audio levels
     mutable std::mutex samples_mutex;  // Protect samples from concurrent access
+    std::vector<float> draw_samples;  // Scratch copy reused by draw() (no per-frame allocation)
     
     // Drawing helpers
     void draw_line_style(Terminal& term, int x, int y, const Theme& theme);